@@ -21,9 +21,22 @@
 #define IMAGE_STORE_SIZE 2000
 #define MAX_LOADED_TEXTURES 150
 #define TEXTURE_EVICTION_TIME_MS 3000
+#define COVER_PREFETCH_TILES 6
+#define COVER_PREFETCH_MAX_QUEUED 32
+#define COVER_PREFETCH_MAX_TEXTURES 120
+#define COVER_PREFETCH_MAX_STREAK 2
+#define COVER_REQUEST_DWELL_MS 120
+#define COVER_REQUEST_GAP_MS 100
 
 #define STEAM_METADATA_WORKER_COUNT 3
+#define ROM_MATCH_CHUNK 16
+#define LAUNCHER_CONTENTS_MAGIC 0x4c43424f
+#define LAUNCHER_CONTENTS_VERSION 2
 #define STEAM_METADATA_MIN_DELAY_MS 200
+#define DESCRIPTION_COMPACT_IDLE_MS 30000
+#define DESCRIPTION_COMPACT_MIN_WASTE 1048576
+#define DESCRIPTION_TRAIN_MIN_BYTES 1048576
+#define LAUNCH_STRING_COMPACT_MIN_WASTE 1048576
 
 // See ROADMAP.md for planned features and backlog
 
@@ -92,6 +105,28 @@ typedef struct User {
     int numCustomFields;   // Number of custom fields
 } User;
 
+// LaunchTarget cold record, string heap and dictionary accessors
+const LaunchTargetCold *targetCold(LaunchTarget *target);
+LaunchTargetCold *writableTargetCold(LaunchTarget *target);
+void resetTarget(LaunchTarget *target);
+char *targetId(LaunchTarget *target);
+char *targetName(LaunchTarget *target);
+char *targetPath(LaunchTarget *target);
+char *targetCoverUrl(LaunchTarget *target);
+int setTargetId(LaunchTarget *target, const char *id);
+int setTargetName(LaunchTarget *target, const char *name);
+int setTargetPath(LaunchTarget *target, const char *path);
+int setTargetCoverUrl(LaunchTarget *target, const char *coverUrl);
+void setTargetMatchScore(LaunchTarget *target, float matchScore);
+void setTargetDescriptionOffset(LaunchTarget *target, off_t offset);
+char *targetPlatform(LaunchTarget *target);
+char *targetOwner(LaunchTarget *target);
+void setTargetPlatform(LaunchTarget *target, const char *platform);
+void setTargetOwner(LaunchTarget *target, const char *owner);
+uint32_t targetOwnedByPlayer(LaunchTarget *target);
+uint32_t targetRetired(LaunchTarget *target);
+void setPlayerOwner(User *user);
+
 // Helper function to get a custom field value from a user
 const char* getUserCustomField(User *user, const char *fieldName) {
     if (!user || !fieldName) return NULL;
@@ -195,11 +230,11 @@ void replaceAllPlaceholders(char *hookCmd, LaunchTarget *target,
 
     // Replace target fields
     if (target) {
-        replacePlaceholder(hookCmd, "%GAME_NAME%", target->name);
-        replacePlaceholder(hookCmd, "%ROM_PATH%", target->path);
-        replacePlaceholder(hookCmd, "%GAME_ID%", target->id);
-        replacePlaceholder(hookCmd, "%GAME_PLATFORM%", target->platform);
-        replacePlaceholder(hookCmd, "%COVER_URL%", target->coverUrl);
+        replacePlaceholder(hookCmd, "%GAME_NAME%", targetName(target));
+        replacePlaceholder(hookCmd, "%ROM_PATH%", targetPath(target));
+        replacePlaceholder(hookCmd, "%GAME_ID%", targetId(target));
+        replacePlaceholder(hookCmd, "%GAME_PLATFORM%", targetPlatform(target));
+        replacePlaceholder(hookCmd, "%COVER_URL%", targetCoverUrl(target));
         replacePlaceholder(hookCmd, "%GAME_DATE%", target->date);
 
         char rankingStr[16];
@@ -267,6 +302,47 @@ typedef struct Image {
     size_t atlasSize;
 } Image;
 
+// Finds a cover's slot by signature and keeps the slots in the order they 
+// were last used, so nothing on the frame path walks the whole store. 
+// Everything in it is guarded by imageStoreLock.
+#define IMAGE_STORE_BUCKETS 4096  // a power of two, about twice the store
+#define IMAGE_SLOT_NONE -1
+
+// Queued covers load nearest the cursor first, counting rows plus tiles. 
+// When the cursor moves everything queued drops behind whatever is drawn 
+// next, and anything not drawn again within a few moves is cancelled.
+#define IMAGE_LOAD_STALE (1u << 24)
+#define IMAGE_LOAD_CANCEL_MOVES 4
+
+typedef struct ImageSlot {
+    int32_t hashNext;
+    int32_t newer;
+    int32_t older;
+    uint32_t uploadPending;
+    uint32_t loadPending;
+    uint32_t loadPosition;     // in the load heap while loadPending
+    uint32_t loadDistance;
+    uint32_t loadCursorMove;   // cursorMoves when the distance was given
+    uint32_t loadSequence;     // first come first served between equals
+} ImageSlot;
+
+typedef struct ImageStoreIndex {
+    int32_t buckets[IMAGE_STORE_BUCKETS];
+    ImageSlot slots[IMAGE_STORE_SIZE];
+    int32_t newest;
+    int32_t oldest;
+
+    // Queued for the workers to load, a binary heap nearest first
+    int32_t loads[IMAGE_STORE_SIZE];
+    uint32_t nLoads;
+    uint32_t nextLoadSequence;
+    uint32_t cursorMoves;
+
+    // Loaded by the workers, waiting for the main thread to upload them
+    int32_t uploads[IMAGE_STORE_SIZE];
+    uint32_t nUploads;
+} ImageStoreIndex;
+
 // SteamGridDB types
 #define MAX_SGDB_COVERS 50
 #define MAX_SGDB_GAMES 10
@@ -308,11 +384,18 @@ typedef struct RomFoundList {
     RomFound *items;
 } RomFoundList;
 
+typedef struct RomMatch {
+    int32_t indexOfEntry;
+    float matchScore;
+} RomMatch;
+
 typedef struct UiTile{
     struct LaunchTarget *target;
     struct UiTile *next; 
     struct UiTile *previous; 
     int32_t baseX;
+    uint32_t firstDrawnTick;  // since it's been drawn without a gap
+    uint32_t lastDrawnTick;
 } UiTile;
 
 typedef struct UiRow {
@@ -498,14 +581,16 @@ typedef struct MainUi {
 
 } MainUi ;
 
-typedef struct LauncherContentsHash {
+// Identity hashes of every ROM a launcher found on its last scan, sorted
+typedef struct LauncherManifest {
     uint32_t launcherSignature;
-    uint32_t contentSignature;
-} LauncherContentsHash;
+    uint32_t nRoms;
+    uint64_t *romHashes;
+} LauncherManifest;
 
 typedef struct LauncherContentsFile {
     uint32_t length;
-    LauncherContentsHash *entries;
+    LauncherManifest *entries;
 } LauncherContentsFile;
 
 typedef struct DownloaderContext {
@@ -630,15 +715,26 @@ typedef struct OffblastUi {
 
     OffblastDbFile descriptionDb;
     OffblastBlobFile *descriptionFile;
+    DescriptionCodec descriptionCodec;
     OffblastDbFile playTimeDb;
     PlayTimeFile *playTimeFile;
-    OffblastDbFile launchTargetDb;
+    OffblastDbFile playTimeRankDb;
+    PlayTimeRankFile *playTimeRankFile;
+    LaunchTargetDb launchTargetDb;
     LaunchTargetFile *launchTargetFile;
+    uint16_t steamPlatformId;
+    uint16_t playerOwnerId;
 
     uint32_t nLaunchers;
     Launcher *launchers;
 
     LauncherContentsFile launcherContentsCache;
+    OffblastDbFile romMatchDb;
+    RomMatchCacheFile *romMatchCache;
+    OffblastDbFile openGameDbRowDb;
+    OpenGameDbRowStateFile *openGameDbRowFile;
+    OffblastDbFile openGameDbPlatformDb;
+    OpenGameDbPlatformStateFile *openGameDbPlatformFile;
 
     uint32_t nCustomLists;
     CustomList customLists[MAX_CUSTOM_LISTS];
@@ -662,10 +758,17 @@ typedef struct OffblastUi {
     pid_t hookPid;
 
     Image *imageStore;
+    ImageStoreIndex *imageIndex;
     pthread_mutex_t imageStoreLock;
+    pthread_cond_t imageLoadQueued;  // signalled with imageStoreLock held
     pthread_mutex_t steamMetadataLock;  // Protects DB modifications during Steam metadata fetch
     uint32_t numLoadedTextures;
 
+    // Cover prefetch budget, set with "cover_prefetch" in the config
+    uint32_t coverPrefetchTiles;
+    uint32_t coverPrefetchMaxQueued;
+    uint32_t coverPrefetchMaxTextures;
+
     // Image loader worker threads
     pthread_t *imageLoadThreads;
     uint32_t numImageLoadThreads;
@@ -677,6 +780,8 @@ typedef struct OffblastUi {
     uint32_t rescrapeInProgress;
     uint32_t rescrapeTotal;
     uint32_t rescrapeProcessed;
+    uint32_t lastInputTick;
+    uint32_t descriptionsCompacted;
 
     // Config options
     uint32_t showInstalledOnly;
@@ -712,6 +817,30 @@ typedef struct WindowInfo {
     Window window;
 } WindowInfo;
 
+typedef struct OpenGameDbImport {
+    OpenGameDbStage *stages;
+    uint32_t nStages;
+    uint32_t nextStage;
+    uint32_t rowsParsed;
+    OpenGameDbPack pack;       // unmapped unless a valid ogdb.pack was found
+    pthread_mutex_t mutex;
+} OpenGameDbImport;
+
+// A change to an existing target, held back until the batches it depends on 
+// are committed
+typedef struct StagedTargetUpdate {
+    uint32_t targetIndex;
+    StagedTarget *staged;
+    uint8_t applyFields;        // otherwise only the row hash and flags
+    off_t descriptionOffset;
+} StagedTargetUpdate;
+
+typedef struct OpenGameDbMergeStats {
+    uint32_t added;
+    uint32_t updated;
+    uint32_t retired;
+} OpenGameDbMergeStats;
+
 
 void condPrintConfigError(void *object, const char *message);
 uint32_t megabytes(uint32_t n);
@@ -719,7 +848,13 @@ uint32_t powTwoFloor(uint32_t val);
 uint32_t needsReRender(SDL_Window *window);
 double easeOutCirc(double t, double b, double c, double d);
 double easeInOutCirc (double t, double b, double c, double d);
-char *getCsvField(char *line, int fieldNo);
+void stageOpenGameDbImport(OpenGameDbImport *import);
+int mergeOpenGameDbStage(OpenGameDbStage *stage, OpenGameDbMergeStats *stats);
+OpenGameDbPlatformState *findOpenGameDbPlatformState(const char *platform);
+int storeOpenGameDbPlatformState(OpenGameDbStage *stage);
+void loadPlatformShard(const char *platform);
+void loadAllPlatformShards();
+void evictUnusedPlatforms();
 double goldenRatioLarge(double in, uint32_t exponent);
 float goldenRatioLargef(float in, uint32_t exponent);
 void horizontalMoveDone();
@@ -756,11 +891,11 @@ void loadCustomLists();
 void buildCustomListRows(MainUi *mainUi, LaunchTargetFile *targetFile);
 void updateInfoText();
 void updateDescriptionText();
+void compactDescriptionsIfWasteful();
+void compactLaunchTargetStringsIfWasteful();
 void updateGameInfo();
 void initQuad(Quad* quad);
 size_t curlWrite(void *contents, size_t size, size_t nmemb, void *userP);
-int playTimeSort(const void *a, const void *b);
-int lastPlayedSort(const void *a, const void *b);
 int rankingSort(const void *a, const void *b);
 int tileRankingSort(const void *a, const void *b);
 int utf8_decode(const char **str);
@@ -793,6 +928,7 @@ void raiseWindowByUuid(const char *uuid);
 void importFromSteam(Launcher *theLauncher);
 void importFromCustom(Launcher *theLauncher);
 void importFromDesktop(Launcher *theLauncher);
+RomMatch *matchRomList(Launcher *theLauncher, RomFoundList *list);
 void loadSteamAchievementCache();
 void updateAchievementsText();
 void loadRAGameCache();
@@ -888,6 +1024,10 @@ typedef struct RAHashVerifyContext {
 SteamMetadata *fetchSteamGameMetadata(uint32_t appid);
 void freeSteamMetadata(SteamMetadata *meta);
 off_t writeDescriptionBlob(LaunchTarget *target, const char *description);
+off_t appendDescriptionField(LaunchTarget *target, 
+        const CsvField *description, OffblastDbBatch *batch);
+int storeDescriptionField(LaunchTarget *target, const CsvField *description,
+        OffblastDbBatch *batch);
 
 // SteamGridDB functions
 SgdbSearchResult *sgdbSearchGames(const char *gameName);
@@ -908,12 +1048,32 @@ void *downloadBadgeMain(void *arg);
 
 WindowInfo getOffblastWindowInfo();
 uint32_t activeWindowIsOffblast();
-uint32_t launcherContentsCacheUpdated(uint32_t launcherSignature, 
-        uint32_t newContentsHash);
+void loadLauncherContentsCache();
+void saveLauncherContentsCache();
+void pruneLauncherContentsCache(uint32_t *launcherSignatures, 
+        uint32_t nLauncherSignatures);
+void invalidateLauncherContents(uint32_t launcherSignature);
+RomFoundList *launcherContentsDiff(Launcher *theLauncher, RomFoundList *list,
+        uint64_t **newRomHashes, uint32_t *nNewRoms);
+void commitLauncherManifest(uint32_t launcherSignature, uint64_t *romHashes, 
+        uint32_t nRoms);
+void pruneRomMatchCache(uint32_t *launcherSignatures, 
+        uint32_t nLauncherSignatures);
+uint64_t romPathHash(const char *path);
 void logMissingGame(char *missingGamePath);
 void logPoorMatch(char *romPath, char *matchedName, float matchScore);
 void calculateRowGeometry(UiRow *row);
-Image *requestImageForTarget(LaunchTarget *target, uint32_t affectQueue);
+Image *requestImageForTarget(LaunchTarget *target, uint32_t affectQueue, 
+        uint32_t distance);
+void initImageStoreIndex();
+int32_t findImageSlot(uint64_t targetSignature);
+void forgetImageSlot(int32_t slot);
+void queueImageUpload(int32_t slot);
+void queueImageLoad(int32_t slot);
+int32_t takeImageLoad();
+void moveImageLoadCursor();
+void prefetchCovers(UiRow *toRow, UiTile *toTile, int32_t rowStep, 
+        int32_t tileStep);
 void changeRowset(UiRowset *rowset);
 
 void *downloadMain(void *arg); 
@@ -980,14 +1140,14 @@ void doImportNewGames() {
     Launcher *targetLauncher = NULL;
     for (uint32_t i = 0; i < offblast->nLaunchers; i++) {
         if (offblast->launchers[i].signature == currentTarget->launcherSignature ||
-            strcmp(offblast->launchers[i].platform, currentTarget->platform) == 0) {
+            strcmp(offblast->launchers[i].platform, targetPlatform(currentTarget)) == 0) {
             targetLauncher = &offblast->launchers[i];
             break;
         }
     }
 
     if (!targetLauncher) {
-        printf("ERROR: Could not find launcher for platform: %s\n", currentTarget->platform);
+        printf("ERROR: Could not find launcher for platform: %s\n", targetPlatform(currentTarget));
         return;
     }
 
@@ -1000,170 +1160,38 @@ void doImportNewGames() {
         return;
     }
 
-    // Open the CSV file for this platform
-    char csvPath[PATH_MAX];
-    snprintf(csvPath, PATH_MAX, "%s/%s.csv", openGameDbPath, targetLauncher->platform);
-    printf("Reading CSV: %s\n", csvPath);
-
-    FILE *csvFile = fopen(csvPath, "r");
-    if (!csvFile) {
-        printf("ERROR: Could not open CSV file: %s\n", csvPath);
-        return;
-    }
-
     // Set status message
     snprintf(offblast->statusMessage, sizeof(offblast->statusMessage),
              "Importing new %.218s games from CSV...", targetLauncher->platform);
     offblast->statusMessageTick = SDL_GetTicks();
     offblast->statusMessageDuration = 60000;
 
-    // Read CSV and create entries for new games only
-    char *csvLine = NULL;
-    size_t csvLineLength = 0;
-    ssize_t csvBytesRead;
-    uint32_t rowCount = 0;
-    uint32_t newGamesAdded = 0;
-
-    LaunchTargetFile *launchTargetFile = offblast->launchTargetFile;
-
-    while ((csvBytesRead = getline(&csvLine, &csvLineLength, csvFile)) != -1) {
-        if (rowCount == 0) {
-            rowCount++;
-            continue; // Skip header
-        }
-        rowCount++;
-
-        // Parse CSV fields
-        char *gameName = getCsvField(csvLine, 1);
-        if (!gameName || strlen(gameName) == 0) continue;
-
-        // Generate signature
-        char *gameSeed;
-        asprintf(&gameSeed, "%s_%s", targetLauncher->platform, gameName);
-        uint64_t targetSignature[2] = {0, 0};
-        lmmh_x64_128(gameSeed, strlen(gameSeed), 33, targetSignature);
-
-        // Check if this game already exists
-        int32_t indexOfEntry = launchTargetIndexByTargetSignature(
-            launchTargetFile, targetSignature[0]);
-
-        if (indexOfEntry == -1) {
-            // New game - create entry
-            printf("  Adding new game: %s\n", gameName);
-
-            // Parse other CSV fields
-            char *gameDate = getCsvField(csvLine, 2);
-            char *scoreString = getCsvField(csvLine, 3);
-            char *metaScoreString = getCsvField(csvLine, 4);
-            char *description = getCsvField(csvLine, 6);
-            char *coverArtUrl = getCsvField(csvLine, 7);
-            char *gameId = getCsvField(csvLine, 8);
-
-            // Grow launch target file
-            void *growState = growDbFileIfNecessary(
-                &offblast->launchTargetDb,
-                sizeof(LaunchTarget),
-                OFFBLAST_DB_TYPE_FIXED);
-
-            if (growState == NULL) {
-                printf("ERROR: Couldn't expand launch target file\n");
-                free(gameName);
-                free(gameSeed);
-                break;
-            }
-
-            launchTargetFile = (LaunchTargetFile*) growState;
-            offblast->launchTargetFile = launchTargetFile;
-
-            LaunchTarget *newEntry = &launchTargetFile->entries[launchTargetFile->nEntries];
-            memset(newEntry, 0, sizeof(LaunchTarget));
-
-            newEntry->targetSignature = targetSignature[0];
-            strncpy(newEntry->name, gameName, OFFBLAST_NAME_MAX - 1);
-            newEntry->name[OFFBLAST_NAME_MAX - 1] = '\0';
-            strncpy(newEntry->platform, targetLauncher->platform, 255);
-            newEntry->platform[255] = '\0';
-            strncpy(newEntry->coverUrl, coverArtUrl, PATH_MAX - 1);
-            newEntry->coverUrl[PATH_MAX - 1] = '\0';
-
-            if (gameId) {
-                strncpy(newEntry->id, gameId, OFFBLAST_NAME_MAX - 1);
-                newEntry->id[OFFBLAST_NAME_MAX - 1] = '\0';
-            }
-
-            // Parse date
-            if (gameDate && strlen(gameDate) == 10) {
-                memcpy(&newEntry->date, gameDate, 10);
-            } else if (gameDate && strlen(gameDate) == 4 && strtod(gameDate, NULL)) {
-                memcpy(&newEntry->date, gameDate, 4);
-            }
-
-            // Parse score
-            float score = -1;
-            if (scoreString && strlen(scoreString) != 0) {
-                float gfScore = atof(scoreString);
-                if (gfScore > 0 && gfScore <= 5.0) {
-                    score = gfScore * 2 * 10;
-                }
-            }
-            if (metaScoreString && strlen(metaScoreString) != 0) {
-                float metaScore = atof(metaScoreString);
-                if (metaScore > 0 && metaScore <= 100) {
-                    if (score == -1) {
-                        score = metaScore;
-                    } else {
-                        score = (score + metaScore) / 2;
-                    }
-                }
-            }
-            if (score == -1) score = 999;
-            newEntry->ranking = (uint32_t)round(score);
-
-            // Write description blob
-            if (description && strlen(description) > 0) {
-                void *pDescriptionFile = growDbFileIfNecessary(
-                    &offblast->descriptionDb,
-                    sizeof(OffblastBlob) + strlen(description),
-                    OFFBLAST_DB_TYPE_BLOB);
-
-                if (pDescriptionFile != NULL) {
-                    offblast->descriptionFile = (OffblastBlobFile*) pDescriptionFile;
-
-                    OffblastBlob *newDescription = (OffblastBlob*)
-                        &offblast->descriptionFile->memory[offblast->descriptionFile->cursor];
-
-                    newDescription->targetSignature = targetSignature[0];
-                    newDescription->length = strlen(description);
-                    memcpy(&newDescription->content, description, strlen(description));
-                    *(newDescription->content + strlen(description)) = '\0';
-
-                    newEntry->descriptionOffset = offblast->descriptionFile->cursor;
-                    offblast->descriptionFile->cursor +=
-                        sizeof(OffblastBlob) + strlen(description) + 1;
-                }
-            }
-
-            launchTargetFile->nEntries++;
-            newGamesAdded++;
-
-            free(gameDate);
-            free(scoreString);
-            free(metaScoreString);
-            free(description);
-            free(coverArtUrl);
-            free(gameId);
-        }
+    // Same as startup, rows that haven't changed since the last import 
+    // are left alone
+    OpenGameDbStage stage = {0};
+    strncpy(stage.platform, targetLauncher->platform, 
+            sizeof(stage.platform) - 1);
 
-        free(gameSeed);
-        free(gameName);
+    if (!stageOpenGameDbPlatform(openGameDbPath, &stage, NULL, NULL)) {
+        printf("ERROR: Could not read CSV for %s\n", targetLauncher->platform);
+        freeOpenGameDbStage(&stage);
+        return;
     }
 
-    free(csvLine);
-    fclose(csvFile);
+    OpenGameDbMergeStats stats = {0};
+    if (mergeOpenGameDbStage(&stage, &stats)) {
+        storeOpenGameDbPlatformState(&stage);
+    }
+    else {
+        printf("ERROR: Couldn't expand the db files\n");
+    }
+    freeOpenGameDbStage(&stage);
 
     // Update status
     snprintf(offblast->statusMessage, sizeof(offblast->statusMessage),
-             "Added %u new %.218s games from CSV", newGamesAdded, targetLauncher->platform);
+             "%.200s: %u new, %u updated, %u retired", 
+             targetLauncher->platform, stats.added, stats.updated, 
+             stats.retired);
     offblast->statusMessageTick = SDL_GetTicks();
     offblast->statusMessageDuration = 3000;
 
@@ -1178,7 +1206,7 @@ void doImportNewGames() {
         changeRowset(currentRowset);
     }
 
-    printf("=== IMPORT COMPLETE: Added %u new games ===\n\n", newGamesAdded);
+    printf("=== IMPORT COMPLETE: Added %u new games ===\n\n", stats.added);
 }
 
 void doRescrapePlatform() {
@@ -1225,13 +1253,7 @@ void doRescanLauncher() {
            targetLauncher->name, targetLauncher->platform);
 
     // Invalidate the cache for this launcher to force a rescan
-    for (uint32_t i = 0; i < offblast->launcherContentsCache.length; i++) {
-        if (offblast->launcherContentsCache.entries[i].launcherSignature == targetLauncher->signature) {
-            printf("Invalidating cache entry for launcher %u\n", targetLauncher->signature);
-            offblast->launcherContentsCache.entries[i].contentSignature = 0;
-            break;
-        }
-    }
+    invalidateLauncherContents(targetLauncher->signature);
 
     // Set status message
     snprintf(offblast->statusMessage, sizeof(offblast->statusMessage),
@@ -1247,10 +1269,10 @@ void doRescanLauncher() {
         for (uint32_t i = 0; i < offblast->launchTargetFile->nEntries; i++) {
             LaunchTarget *target = &offblast->launchTargetFile->entries[i];
             if (target->launcherSignature == targetLauncher->signature) {
-                memset(target->path, 0, PATH_MAX);
+                setTargetPath(target, "");
                 target->launcherSignature = 0;  // Clear launcher assignment
-                target->matchScore = 0.0;
-                printf("  Cleared assignment for: %s\n", target->name);
+                setTargetMatchScore(target, 0.0);
+                printf("  Cleared assignment for: %s\n", targetName(target));
             }
         }
     }
@@ -1268,23 +1290,7 @@ void doRescanLauncher() {
     }
 
     // Save updated cache to disk
-    char *configPath = offblast->configPath;
-    char *launcherContentsHashFilePath;
-    asprintf(&launcherContentsHashFilePath, "%s/launchercontents.bin", configPath);
-
-    FILE *launcherContentsFd = fopen(launcherContentsHashFilePath, "wb");
-    if (launcherContentsFd) {
-        fwrite(&offblast->launcherContentsCache.length, sizeof(uint32_t), 1, launcherContentsFd);
-        fwrite(offblast->launcherContentsCache.entries,
-               sizeof(LauncherContentsHash),
-               offblast->launcherContentsCache.length,
-               launcherContentsFd);
-        fclose(launcherContentsFd);
-        printf("Updated launcher contents cache\n");
-    } else {
-        printf("WARNING: Could not save launcher contents cache\n");
-    }
-    free(launcherContentsHashFilePath);
+    saveLauncherContentsCache();
 
     // Update UI - preserve current rowset
     UiRowset *currentRowset = mainUi->activeRowset;
@@ -1336,22 +1342,10 @@ void doRefreshCover() {
 
     uint64_t sig = target->targetSignature;
 
-    // Find and evict the texture for this game
+    // Evict the texture for this game so it will be re-queued
     pthread_mutex_lock(&offblast->imageStoreLock);
-    for (uint32_t i = 0; i < IMAGE_STORE_SIZE; i++) {
-        if (offblast->imageStore[i].targetSignature == sig) {
-            // Delete OpenGL texture if loaded
-            if (offblast->imageStore[i].textureHandle != 0) {
-                glDeleteTextures(1, &offblast->imageStore[i].textureHandle);
-                offblast->imageStore[i].textureHandle = 0;
-                offblast->numLoadedTextures--;
-            }
-            // Reset state so it will be re-queued
-            offblast->imageStore[i].state = IMAGE_STATE_COLD;
-            offblast->imageStore[i].targetSignature = 0;
-            break;
-        }
-    }
+    int32_t slot = findImageSlot(sig);
+    if (slot != IMAGE_SLOT_NONE) forgetImageSlot(slot);
     pthread_mutex_unlock(&offblast->imageStoreLock);
 
     snprintf(offblast->statusMessage, 256, "Cover refreshed");
@@ -1578,7 +1572,7 @@ void doViewAchievements() {
 	}
 
 	// Only works for non-Steam games with RA data
-	if (strcmp(target->platform, "steam") == 0) {
+	if (target->platformId == offblast->steamPlatformId) {
 		snprintf(offblast->statusMessage, 256, "Steam achievement browser not implemented yet");
 		offblast->statusMessageTick = SDL_GetTicks();
 		offblast->statusMessageDuration = 3000;
@@ -1600,7 +1594,7 @@ void doViewAchievements() {
 		snprintf(offblast->statusMessage, 256, "No RetroAchievements data for this game");
 		offblast->statusMessageTick = SDL_GetTicks();
 		offblast->statusMessageDuration = 3000;
-		printf("[Achievement Browser] No verified RA data for %s\n", target->name);
+		printf("[Achievement Browser] No verified RA data for %s\n", targetName(target));
 		return;
 	}
 
@@ -1658,7 +1652,7 @@ void doViewAchievements() {
 	ui->achievementBrowserRaGameId = raCache->raGameId;
 	ui->achievementCursor = 0;
 	ui->achievementScrollOffset = 0;
-	snprintf(ui->achievementBrowserTitle, sizeof(ui->achievementBrowserTitle), "%s", target->name);
+	snprintf(ui->achievementBrowserTitle, sizeof(ui->achievementBrowserTitle), "%s", targetName(target));
 
 	// Initialize badge images
 	pthread_mutex_init(&ui->achievementBadgesLock, NULL);
@@ -1676,7 +1670,7 @@ void doViewAchievements() {
 	// Queue badges for visible achievements
 	queueAchievementBadges();
 
-	printf("[Achievement Browser] Opened for %s (RA game %u)\n", target->name, raCache->raGameId);
+	printf("[Achievement Browser] Opened for %s (RA game %u)\n", targetName(target), raCache->raGameId);
 }
 
 void *downloadCoverMain(void *arg) {
@@ -1773,13 +1767,11 @@ void *downloadCoverMain(void *arg) {
 	// Just mark the image as COLD - don't delete textures from background thread!
 	// The main thread will handle texture deletion and reloading naturally
 	pthread_mutex_lock(&offblast->imageStoreLock);
-	for (uint32_t i = 0; i < IMAGE_STORE_SIZE; i++) {
-		if (offblast->imageStore[i].targetSignature == ctx->targetSignature) {
-			// Mark as COLD so it will reload from the new file
-			// Don't call glDeleteTextures from background thread - OpenGL isn't thread-safe!
-			offblast->imageStore[i].state = IMAGE_STATE_COLD;
-			break;
-		}
+	int32_t slot = findImageSlot(ctx->targetSignature);
+	if (slot != IMAGE_SLOT_NONE) {
+		// Mark as COLD so it will reload from the new file
+		// Don't call glDeleteTextures from background thread - OpenGL isn't thread-safe!
+		offblast->imageStore[slot].state = IMAGE_STATE_COLD;
 	}
 	pthread_mutex_unlock(&offblast->imageStoreLock);
 
@@ -1804,7 +1796,7 @@ void coverBrowserSelectCover() {
 	SgdbCover *cover = &ui->coverBrowserCovers->covers[ui->coverBrowserCoverCursor];
 
 	printf("=== Cover Selection ===\n");
-	printf("Game: %s (signature: %"PRIu64")\n", target->name, target->targetSignature);
+	printf("Game: %s (signature: %"PRIu64")\n", targetName(target), target->targetSignature);
 	printf("Selected cover URL: %s\n", cover->url);
 
 	// Create context for background download
@@ -1957,9 +1949,9 @@ void doBrowseCovers() {
 
 	// Determine if this is a Steam game
 	uint32_t sgdbGameId = 0;
-	if (strcmp(target->platform, "steam") == 0) {
+	if (target->platformId == offblast->steamPlatformId) {
 		// Steam game - extract appid from target->id
-		uint32_t steamAppId = atoi(target->id);
+		uint32_t steamAppId = atoi(targetId(target));
 		printf("Looking up SteamGridDB game for Steam AppID %u\n", steamAppId);
 		sgdbGameId = sgdbGetGameBySteamId(steamAppId);
 
@@ -1970,12 +1962,12 @@ void doBrowseCovers() {
 		}
 	} else {
 		// Non-Steam game - search by name
-		printf("Searching SteamGridDB for: %s\n", target->name);
-		ui->coverBrowserGames = sgdbSearchGames(target->name);
+		printf("Searching SteamGridDB for: %s\n", targetName(target));
+		ui->coverBrowserGames = sgdbSearchGames(targetName(target));
 
 		if (!ui->coverBrowserGames || ui->coverBrowserGames->numGames == 0) {
 			snprintf(ui->coverBrowserError, 256,
-				"No games found for '%s'", target->name);
+				"No games found for '%s'", targetName(target));
 			ui->coverBrowserState = 0;
 			if (ui->coverBrowserGames) free(ui->coverBrowserGames);
 			ui->coverBrowserGames = NULL;
@@ -2158,6 +2150,45 @@ void *initThreadFunc(void *arg) {
         printf("Show installed only: %s\n", offblast->showInstalledOnly ? "yes" : "no");
     }
 
+    offblast->coverPrefetchTiles = COVER_PREFETCH_TILES;
+    offblast->coverPrefetchMaxQueued = COVER_PREFETCH_MAX_QUEUED;
+    offblast->coverPrefetchMaxTextures = COVER_PREFETCH_MAX_TEXTURES;
+
+    json_object *configCoverPrefetch;
+    json_object_object_get_ex(configObj, "cover_prefetch",
+            &configCoverPrefetch);
+    if (configCoverPrefetch) {
+        json_object *prefetchTiles, *prefetchMaxQueued, *prefetchMaxTextures;
+
+        if (json_object_object_get_ex(configCoverPrefetch, "tiles", 
+                    &prefetchTiles)) 
+        {
+            offblast->coverPrefetchTiles = json_object_get_int(prefetchTiles);
+        }
+        if (json_object_object_get_ex(configCoverPrefetch, "max_queued", 
+                    &prefetchMaxQueued)) 
+        {
+            offblast->coverPrefetchMaxQueued = 
+                json_object_get_int(prefetchMaxQueued);
+        }
+        if (json_object_object_get_ex(configCoverPrefetch, "max_textures", 
+                    &prefetchMaxTextures)) 
+        {
+            offblast->coverPrefetchMaxTextures = 
+                json_object_get_int(prefetchMaxTextures);
+        }
+
+        // Leave room for what's on screen
+        if (offblast->coverPrefetchMaxTextures > MAX_LOADED_TEXTURES) {
+            offblast->coverPrefetchMaxTextures = MAX_LOADED_TEXTURES;
+        }
+
+        printf("Cover prefetch: %u tiles, %u queued, %u textures\n", 
+                offblast->coverPrefetchTiles, 
+                offblast->coverPrefetchMaxQueued, 
+                offblast->coverPrefetchMaxTextures);
+    }
+
     // Parse Steam API config
     json_object *configSteam;
     json_object_object_get_ex(configObj, "steam", &configSteam);
@@ -2197,28 +2228,24 @@ void *initThreadFunc(void *arg) {
 		}
 	}
 
-    char *launchTargetDbPath;
-    asprintf(&launchTargetDbPath, "%s/launchtargets.bin", configPath);
-    OffblastDbFile launchTargetDb = {0};
     SET_STATUS("Initializing game database...");
-    if (!InitDbFile(launchTargetDbPath, &launchTargetDb, 
-                sizeof(LaunchTarget))) 
-    {
+    if (!InitLaunchTargetDb(configPath, &offblast->launchTargetDb)) {
         printf("couldn't initialize path db, exiting\n");
         SET_ERROR("Initialization error");
         return NULL;
     }
+    compactLaunchTargetStringsIfWasteful();
     LaunchTargetFile *launchTargetFile =
-        (LaunchTargetFile*) launchTargetDb.memory;
-    offblast->launchTargetDb = launchTargetDb;
+        (LaunchTargetFile*) offblast->launchTargetDb.targets.memory;
     offblast->launchTargetFile = launchTargetFile;
-    free(launchTargetDbPath);
+    offblast->steamPlatformId = 
+        launchTargetDictId(&offblast->launchTargetDb, "steam");
 
     char *descriptionDbPath;
     asprintf(&descriptionDbPath, "%s/descriptions.bin", configPath);
     offblast->descriptionDb = (OffblastDbFile){0};
-    if (!InitDbFile(descriptionDbPath, &offblast->descriptionDb,
-                1))
+    if (!initDescriptionDb(descriptionDbPath, &offblast->descriptionDb,
+                &offblast->launchTargetDb))
     {
         printf("couldn't initialize the descriptions file, exiting\n");
         SET_ERROR("Initialization error");
@@ -2226,32 +2253,72 @@ void *initThreadFunc(void *arg) {
     }
     offblast->descriptionFile =
         (OffblastBlobFile*) offblast->descriptionDb.memory;
+    loadDescriptionCodec(&offblast->descriptionCodec, 
+            &offblast->descriptionDb);
     free(descriptionDbPath);
 
 
-    char *launcherContentsHashFilePath;
-    asprintf(&launcherContentsHashFilePath, 
-            "%s/launchercontents.bin", configPath);
+    loadLauncherContentsCache();
 
-    FILE *launcherContentsFd = fopen(launcherContentsHashFilePath, "rb");
-    offblast->launcherContentsCache.length = 0; 
-    uint32_t lengthHeader = 0;
-    if (launcherContentsFd != NULL 
-            && fread(&lengthHeader, sizeof(uint32_t), 1 , launcherContentsFd) > 0)
+    char *romMatchDbPath;
+    asprintf(&romMatchDbPath, "%s/rommatches.bin", configPath);
+    offblast->romMatchDb = (OffblastDbFile){0};
+    if (InitDbFile(romMatchDbPath, &offblast->romMatchDb, 
+                sizeof(RomMatchCacheEntry))) 
     {
-        printf("Got something (%u) in the contents cache\n", lengthHeader);
-        offblast->launcherContentsCache.length = lengthHeader;
-        offblast->launcherContentsCache.entries = 
-            calloc(lengthHeader, sizeof(LauncherContentsHash));
-
-        size_t itemsRead = fread(offblast->launcherContentsCache.entries, 
-            sizeof(LauncherContentsHash), lengthHeader, launcherContentsFd);
+        offblast->romMatchCache = 
+            (RomMatchCacheFile*) offblast->romMatchDb.memory;
 
-        assert(itemsRead == lengthHeader);
-        fclose(launcherContentsFd);
+        if (offblast->romMatchCache->version != ROM_MATCH_CACHE_VERSION) {
+            offblast->romMatchCache->nEntries = 0;
+            offblast->romMatchCache->version = ROM_MATCH_CACHE_VERSION;
+        }
     }
     else {
-        printf("No contents hash found, everything will rescrape.\n");
+        // Everything still works without it, it just matches every time
+        printf("couldn't initialize the ROM match cache\n");
+        offblast->romMatchCache = NULL;
+    }
+    free(romMatchDbPath);
+
+    char *openGameDbRowDbPath;
+    asprintf(&openGameDbRowDbPath, "%s/ogdbrows.bin", configPath);
+    char *openGameDbPlatformDbPath;
+    asprintf(&openGameDbPlatformDbPath, "%s/ogdbplatforms.bin", configPath);
+    offblast->openGameDbRowDb = (OffblastDbFile){0};
+    offblast->openGameDbPlatformDb = (OffblastDbFile){0};
+
+    if (!InitDbFile(openGameDbRowDbPath, &offblast->openGameDbRowDb, 
+                sizeof(OpenGameDbRowState))
+            || !InitDbFile(openGameDbPlatformDbPath, 
+                &offblast->openGameDbPlatformDb, 
+                sizeof(OpenGameDbPlatformState))) 
+    {
+        printf("couldn't initialize the opengamedb import state, exiting\n");
+        SET_ERROR("Initialization error");
+        return NULL;
+    }
+    free(openGameDbRowDbPath);
+    free(openGameDbPlatformDbPath);
+
+    offblast->openGameDbRowFile = 
+        (OpenGameDbRowStateFile*) offblast->openGameDbRowDb.memory;
+    offblast->openGameDbPlatformFile = 
+        (OpenGameDbPlatformStateFile*) offblast->openGameDbPlatformDb.memory;
+
+    // Row hashes are by target index, so they mean nothing once the 
+    // targets have been wiped; every platform is then imported afresh
+    if (offblast->openGameDbRowFile->version != OPENGAMEDB_ROW_STATE_VERSION
+            || offblast->openGameDbPlatformFile->version 
+                != OPENGAMEDB_ROW_STATE_VERSION
+            || offblast->openGameDbRowFile->nEntries 
+                > launchTargetFile->nEntries) 
+    {
+        offblast->openGameDbRowFile->nEntries = 0;
+        offblast->openGameDbRowFile->version = OPENGAMEDB_ROW_STATE_VERSION;
+        offblast->openGameDbPlatformFile->nEntries = 0;
+        offblast->openGameDbPlatformFile->version = 
+            OPENGAMEDB_ROW_STATE_VERSION;
     }
 
 
@@ -2284,258 +2351,137 @@ void *initThreadFunc(void *arg) {
         return NULL;
     }
 
+    OpenGameDbImport openGameDbImport = {0};
+    uint32_t stageCapacity = 0;
+
     while ((openGameDbEntry = readdir(openGameDbDir)) != NULL) {
         if (openGameDbEntry->d_name[0] == '.') continue;
-        if (strcmp(openGameDbEntry->d_name, ".") == 0) continue;
-        if (strcmp(openGameDbEntry->d_name, "..") == 0) continue;
         char *ext = strrchr((char*)openGameDbEntry->d_name, '.');
-        if (ext == NULL) continue;
+        if (ext == NULL || strcmp(ext, ".csv") != 0) continue;
 
-        if (strcmp(ext, ".csv") == 0) {
-            // Skip steam.csv - Steam games come from API, not OpenGameDB
-            if (strcmp(openGameDbEntry->d_name, "steam.csv") == 0) {
-                printf("Skipping steam.csv (Steam games imported via API)\n");
-                continue;
-            }
-            printf("Importing game data from %s\n", openGameDbEntry->d_name);
-        }
-        else {
+        // Skip steam.csv - Steam games come from API, not OpenGameDB
+        if (strcmp(openGameDbEntry->d_name, "steam.csv") == 0) {
+            printf("Skipping steam.csv (Steam games imported via API)\n");
             continue;
         }
 
-        char *fileNameSplit = strtok(openGameDbEntry->d_name, ".");
-        uint32_t platformScraped = 0;
-        for (uint32_t i=0; i < launchTargetFile->nEntries; ++i) {
-            if (strcmp(launchTargetFile->entries[i].platform, 
-                        &fileNameSplit[0]) == 0) 
-            {
-                printf("%s already scraped.\n", &fileNameSplit[0]);
-                platformScraped = 1;
-                break;
+        *ext = '\0';
+        char *platform = openGameDbEntry->d_name;
+
+        // Only CSVs that have changed since they were last imported are 
+        // looked at again
+        OpenGameDbPlatformState *platformState = 
+            findOpenGameDbPlatformState(platform);
+        if (platformState) {
+            char *csvPath;
+            asprintf(&csvPath, "%s/%s.csv", openGameDbPath, platform);
+            struct stat sb;
+            int unchanged = stat(csvPath, &sb) == 0 
+                && (uint64_t) sb.st_size == platformState->csvSize
+                && openGameDbCsvMtime(&sb) == platformState->csvMtime;
+            free(csvPath);
+
+            if (unchanged) {
+                printf("%s already scraped.\n", platform);
+                continue;
             }
         }
 
-        if (!platformScraped) {
-
-            char statusMsg[256];
-            snprintf(statusMsg, 256, "Loading %s games...", fileNameSplit);
-            SET_STATUS(statusMsg);
-
-            printf("Pulling data in from the opengamedb.\n");
-            char *openGameDbPlatformPath;
-            asprintf(&openGameDbPlatformPath, "%s/%s.csv", 
-                    openGameDbPath, 
-                    openGameDbEntry->d_name);
-            printf("Looking for file %s\n", openGameDbPlatformPath);
-
-            FILE *openGameDbFile = fopen(openGameDbPlatformPath, "r");
-            if (openGameDbFile == NULL) {
-                printf("looks like theres no opengamedb for the platform\n");
-                free(openGameDbPlatformPath);
-                break;
+        if (openGameDbImport.nStages == stageCapacity) {
+            stageCapacity = stageCapacity ? stageCapacity * 2 : 32;
+            OpenGameDbStage *stages = realloc(openGameDbImport.stages, 
+                    stageCapacity * sizeof(OpenGameDbStage));
+            if (!stages) {
+                SET_ERROR("Initialization error");
+                return NULL;
             }
-            free(openGameDbPlatformPath);
-            openGameDbPlatformPath = NULL;
-
-            char *csvLine = NULL;
-            size_t csvLineLength = 0;
-            size_t csvBytesRead = 0;
-            uint32_t onRow = 0;
-
-
-            while ((csvBytesRead = getline(
-                            &csvLine, &csvLineLength, openGameDbFile)) != -1)
-            {
-                if (onRow > 0) {
-
-                    // Update progress every 10 games to reduce mutex overhead
-                    if (onRow % 10 == 0) {
-                        pthread_mutex_lock(&offblast->loadingState.mutex);
-                        offblast->loadingState.progress = onRow;
-                        offblast->loadingState.progressTotal = 0;  // Unknown total
-                        pthread_mutex_unlock(&offblast->loadingState.mutex);
-                    }
-
-                    char *gameName = getCsvField(csvLine, 1);
-                    char *gameDate = getCsvField(csvLine, 2);
-                    char *scoreString = getCsvField(csvLine, 3);
-                    char *metaScoreString = getCsvField(csvLine, 4);
-                    char *description = getCsvField(csvLine, 6);
-                    char *coverArtUrl = getCsvField(csvLine, 7);
-                    char *gameId = getCsvField(csvLine, 8);
-
-                    char *gameSeed;
-
-                    // Include title_id in signature if available to differentiate regional versions
-                    if (gameId != NULL && strlen(gameId) > 0) {
-                        asprintf(&gameSeed, "%s_%s_%s",
-                                &fileNameSplit[0], gameName, gameId);
-                    } else {
-                        asprintf(&gameSeed, "%s_%s",
-                                &fileNameSplit[0], gameName);
-                    }
-
-                    uint64_t targetSignature[2] = {0, 0};
-                    lmmh_x64_128(gameSeed, strlen(gameSeed), 33,
-                            targetSignature);
-
-                    int32_t indexOfEntry = launchTargetIndexByTargetSignature(
-                            launchTargetFile, targetSignature[0]);
-
-                    if (indexOfEntry == -1) {
-
-                        void *pLaunchTargetMemory = growDbFileIfNecessary(
-                                    &launchTargetDb,
-                                    sizeof(LaunchTarget),
-                                    OFFBLAST_DB_TYPE_FIXED);
-
-                        if(pLaunchTargetMemory == NULL) {
-                            printf("Couldn't expand the db file to accomodate"
-                                    " all the targets\n");
-                            SET_ERROR("Initialization error");
-                            return NULL;
-                        }
-                        else {
-                            launchTargetFile =
-                                (LaunchTargetFile*) pLaunchTargetMemory;
-                            offblast->launchTargetFile = launchTargetFile;
-                        }
-
-                        printf("\n--\nAdding: \n%s\n%" PRIu64 "\n%s\n%s\ng: %s\n\nm: %s\n%s\n",
-                                gameSeed,
-                                targetSignature[0],
-                                gameName,
-                                gameDate,
-                                scoreString, metaScoreString, gameId);
-
-                        LaunchTarget *newEntry =
-                            &launchTargetFile->entries[launchTargetFile->nEntries];
-                        printf("writing new game to %p\n", newEntry);
-
-                        // Zero the entire structure to ensure null-terminated strings
-                        memset(newEntry, 0, sizeof(LaunchTarget));
-
-                        newEntry->targetSignature = targetSignature[0];
-
-                        strncpy(newEntry->name, gameName, OFFBLAST_NAME_MAX - 1);
-                        newEntry->name[OFFBLAST_NAME_MAX - 1] = '\0';
-
-                        strncpy(newEntry->platform, &fileNameSplit[0], 255);
-                        newEntry->platform[255] = '\0';
-
-                        strncpy(newEntry->coverUrl, coverArtUrl, PATH_MAX - 1);
-                        newEntry->coverUrl[PATH_MAX - 1] = '\0';
-
-                        strncpy(newEntry->id, gameId, OFFBLAST_NAME_MAX - 1);
-                        newEntry->id[OFFBLAST_NAME_MAX - 1] = '\0';
-
-                        // TODO harden
-                        if (strlen(gameDate) == 10) {
-                            memcpy(&newEntry->date, gameDate, 10);
-                        }
-                        if (strlen(gameDate) == 4 && strtod(gameDate, NULL)) {
-                            memcpy(&newEntry->date, gameDate, 4);
-                        }
-                        else {
-                            printf("INVALID DATE FORMAT\n");
-                        }
-
-                        float score = -1;
-                        if (strlen(scoreString) != 0) {
-                            float gfScore = atof(scoreString);
-                            // Validate: must be numeric and in valid range
-                            if (gfScore > 0 && gfScore <= 5.0) {
-                                score = gfScore * 2 * 10;
-                            }
-                        }
-                        if (strlen(metaScoreString) != 0) {
-                            float metaScore = atof(metaScoreString);
-                            // Validate: must be numeric and in valid range
-                            if (metaScore > 0 && metaScore <= 100) {
-                                if (score == -1) {
-                                    score = metaScore;
-                                }
-                                else {
-                                    score = (score + metaScore) / 2;
-                                }
-                            }
-                        }
+            openGameDbImport.stages = stages;
+        }
 
-                        // If no valid score, use sentinel value
-                        if (score == -1) {
-                            score = 999;
-                        }
+        OpenGameDbStage *stage = 
+            &openGameDbImport.stages[openGameDbImport.nStages++];
+        memset(stage, 0, sizeof(OpenGameDbStage));
+        strncpy(stage->platform, platform, sizeof(stage->platform) - 1);
 
-                        void *pDescriptionFile = growDbFileIfNecessary(
-                                    &offblast->descriptionDb,
-                                    sizeof(OffblastBlob)
-                                        + strlen(description),
-                                    OFFBLAST_DB_TYPE_BLOB); 
-
-                        if(pDescriptionFile == NULL) {
-                            printf("Couldn't expand the description file to "
-                                    "accomodate all the descriptions\n");
-                            SET_ERROR("Initialization error");
-                            return NULL;
-                        }
-                        else { 
-                            offblast->descriptionFile = 
-                                (OffblastBlobFile*) pDescriptionFile;
-                        }
+        printf("Importing game data from %s.csv\n", platform);
+    }
+    closedir(openGameDbDir);
 
-                        printf("description file just after cursor is now %lu\n", 
-                                offblast->descriptionFile->cursor);
+    if (openGameDbImport.nStages > 0) {
 
-                        OffblastBlob *newDescription = (OffblastBlob*) 
-                            &offblast->descriptionFile->memory[
-                                offblast->descriptionFile->cursor];
+        char statusMsg[256];
+        snprintf(statusMsg, 256, "Loading games for %u platforms...", 
+                openGameDbImport.nStages);
+        SET_STATUS(statusMsg);
 
-                        newDescription->targetSignature = targetSignature[0];
-                        newDescription->length = strlen(description);
+        // A prebuilt pack saves parsing any CSV it still matches
+        char *packPath;
+        asprintf(&packPath, "%s/ogdb.pack", openGameDbPath);
+        if (mapOpenGameDbPack(packPath, &openGameDbImport.pack)) {
+            printf("Using opengamedb pack %s\n", packPath);
+        }
 
-                        memcpy(&newDescription->content, description, 
-                                strlen(description));
-                        *(newDescription->content + strlen(description)) = '\0';
+        // Platforms are staged in parallel, only merging them into the db 
+        // files below is serial
+        stageOpenGameDbImport(&openGameDbImport);
 
-                        newEntry->descriptionOffset =
-                            offblast->descriptionFile->cursor;
+        uint32_t nParsed = 0;
+        for (uint32_t s = 0; s < openGameDbImport.nStages; ++s) {
+            OpenGameDbStage *stage = &openGameDbImport.stages[s];
+            if (!stage->fromPack && !stage->failed) nParsed++;
+        }
 
-                        offblast->descriptionFile->cursor +=
-                            sizeof(OffblastBlob) + strlen(description) + 1;
+        // Refresh the pack so the next import of these platforms doesn't 
+        // need their CSVs parsed
+        if (nParsed > 0) {
+            SET_STATUS("Updating game metadata pack...");
+            writeOpenGameDbPack(packPath, openGameDbImport.stages, 
+                    openGameDbImport.nStages, &openGameDbImport.pack);
+        }
+        free(packPath);
 
-                        printf("Stored description for '%s' at offset %lu, cursor now %lu\n",
-                                gameName, newEntry->descriptionOffset,
-                                offblast->descriptionFile->cursor);
+        SET_STATUS("Storing game metadata...");
 
-                        newEntry->ranking = (uint32_t)round(score);
+        for (uint32_t s = 0; s < openGameDbImport.nStages; ++s) {
+            OpenGameDbStage *stage = &openGameDbImport.stages[s];
+            SET_PROGRESS(s, openGameDbImport.nStages);
 
-                        launchTargetFile->nEntries++;
+            if (stage->failed) {
+                freeOpenGameDbStage(stage);
+                continue;
+            }
 
-                        free(gameDate);
-                        free(scoreString);
-                        free(metaScoreString);
-                        free(description);
-                        free(coverArtUrl);
-                        free(gameId);
+            // Touched but not edited, nothing to merge
+            OpenGameDbPlatformState *platformState = 
+                findOpenGameDbPlatformState(stage->platform);
+            if (platformState && platformState->csvSize == stage->csvSize
+                    && platformState->contentHash[0] == stage->contentHash[0]
+                    && platformState->contentHash[1] == stage->contentHash[1])
+            {
+                storeOpenGameDbPlatformState(stage);
+                freeOpenGameDbStage(stage);
+                continue;
+            }
 
-                    }
-                    else {
-                        printf("%d index found, We already have %"PRIu64":%s\n",
-                                indexOfEntry,
-                                targetSignature[0],
-                                gameSeed);
-                    }
+            OpenGameDbMergeStats stats = {0};
+            if (!mergeOpenGameDbStage(stage, &stats)) {
+                printf("Couldn't expand the db files to accomodate"
+                        " all the targets\n");
+                SET_ERROR("Initialization error");
+                return NULL;
+            }
+            storeOpenGameDbPlatformState(stage);
 
-                    free(gameSeed);
-                    free(gameName);
-                }
+            printf("Imported %u of %u %s games from the opengamedb, "
+                    "%u updated, %u retired\n", stats.added, stage->nTargets, 
+                    stage->platform, stats.updated, stats.retired);
 
-                onRow++;
-            }
-            free(csvLine);
-            fclose(openGameDbFile);
+            freeOpenGameDbStage(stage);
         }
+        launchTargetFile = offblast->launchTargetFile;
     }
+    unmapOpenGameDbPack(&openGameDbImport.pack);
+    free(openGameDbImport.stages);
 
 
     SET_STATUS("Loading user profiles...");
@@ -2925,6 +2871,9 @@ void *initThreadFunc(void *arg) {
         }
 
 
+        // Matching needs the platform's targets
+        loadPlatformShard(theLauncher->platform);
+
         // Import games based on launcher type
         if (strcmp(theLauncher->type, "steam") == 0) {
             // DEFER: Steam import happens after player selection (need to know which Steam account)
@@ -2948,17 +2897,11 @@ void *initThreadFunc(void *arg) {
 
     }
 
-    // Write out the contents cache
-    launcherContentsFd = fopen(launcherContentsHashFilePath, "wb");
-    assert(launcherContentsFd);
-    fwrite(&offblast->launcherContentsCache.length, 
-            sizeof(uint32_t), 1, launcherContentsFd);
-    fwrite(
-            offblast->launcherContentsCache.entries, 
-            sizeof(LauncherContentsHash), 
-            offblast->launcherContentsCache.length, 
-            launcherContentsFd);
-    fclose(launcherContentsFd);
+    // Write out the contents cache, launchers that were dropped from the
+    // config lose their manifest so they match from scratch if re-added
+    pruneLauncherContentsCache(configLauncherSignatures, nConfigLaunchers);
+    saveLauncherContentsCache();
+    pruneRomMatchCache(configLauncherSignatures, nConfigLaunchers);
 
     // Clean up orphaned games (games from launchers no longer in config)
     for (int i = 0; i < launchTargetFile->nEntries; ++i) {
@@ -2976,21 +2919,26 @@ void *initThreadFunc(void *arg) {
 
         if (isOrphan) {
             printf("ORPHANED GAME: %s (signature %u)\n",
-                    launchTargetFile->entries[i].name,
+                    targetName(&launchTargetFile->entries[i]),
                     launchTargetFile->entries[i].launcherSignature);
             printf("       Clearing path and resetting for re-matching\n");
 
             // Clear launcher association, path, and matchScore
             // This allows the ROM to be re-matched by a replacement launcher
             launchTargetFile->entries[i].launcherSignature = 0;
-            memset(launchTargetFile->entries[i].path, 0x00, PATH_MAX);
-            launchTargetFile->entries[i].matchScore = 0.0f;
+            setTargetPath(&launchTargetFile->entries[i], "");
+            setTargetMatchScore(&launchTargetFile->entries[i], 0.0f);
         }
     }
 
     printf("DEBUG - got %u platforms\n", offblast->nPlatforms);
 
-    close(launchTargetDb.fd);
+    // Lists say which other platforms are needed up front
+    loadCustomLists();
+
+    SET_STATUS("Sharding unused platforms...");
+    evictUnusedPlatforms();
+    launchTargetFile = offblast->launchTargetFile;
 
 
 
@@ -3040,13 +2988,14 @@ void *initThreadFunc(void *arg) {
     SET_STATUS("Setting up image system...");
     // CREATE IMAGE STORE
     pthread_mutex_init(&offblast->imageStoreLock, NULL);
+    pthread_cond_init(&offblast->imageLoadQueued, NULL);
     pthread_mutex_init(&offblast->steamMetadataLock, NULL);
     offblast->imageStore = calloc(IMAGE_STORE_SIZE, sizeof(Image));
+    offblast->imageIndex = calloc(1, sizeof(ImageStoreIndex));
     offblast->numLoadedTextures = 0;
-    for (uint32_t i = 0; i < IMAGE_STORE_SIZE; ++i) {
-        offblast->imageStore[i].lastUsedTick = SDL_GetTicks();
-    }
     assert(offblast->imageStore);
+    assert(offblast->imageIndex);
+    initImageStoreIndex();
 
     // Initialize rcheevos default file reader (enables .zip support)
     rc_hash_init_custom_filereader(NULL);
@@ -3666,9 +3615,6 @@ int main(int argc, char** argv) {
 
     mainUi->rowGeometryInvalid = 1;
 
-    // Load custom lists from ~/.offblast/lists/*.json
-    loadCustomLists();
-
     updateHomeLists();
 
     // Start fade-in animation for initial screen
@@ -3700,6 +3646,8 @@ int main(int argc, char** argv) {
         SDL_Event event;
 
         while (SDL_PollEvent(&event)) {
+            offblast->lastInputTick = SDL_GetTicks();
+
             if (event.type == SDL_QUIT) {
                 printf("shutting down\n");
                 offblast->running = 0;
@@ -3955,6 +3903,7 @@ int main(int argc, char** argv) {
 
                 offblast->player.user = theUser;
                 offblast->player.emailHash = emailSignature;
+                setPlayerOwner(theUser);
 
                 // Clear previous user's RA cache (shouldn't exist on auto-select, but be safe)
                 if (offblast->retroAchievementsCache) {
@@ -3992,6 +3941,18 @@ int main(int argc, char** argv) {
             lastEvictionCheck = currentTick;
         }
 
+        // Descriptions are only ever appended, reclaim the space once a 
+        // session while nobody is using the UI
+        if (!offblast->descriptionsCompacted
+                && offblast->mode == OFFBLAST_UI_MODE_MAIN
+                && offblast->playingTarget == NULL
+                && currentTick - offblast->lastInputTick 
+                    > DESCRIPTION_COMPACT_IDLE_MS)
+        {
+            offblast->descriptionsCompacted = 1;
+            compactDescriptionsIfWasteful();
+        }
+
         // RENDER
         glClearColor(0.0, 0.0, 0.0, 1.0);
         glClear(GL_COLOR_BUFFER_BIT);
@@ -4023,10 +3984,38 @@ int main(int argc, char** argv) {
                     mainUi->rowGeometryInvalid = 0;
                 }
 
+                // Covers queued around the old cursor give way to the 
+                // ones drawn around the new one
+                static UiTile *loadCursorTile = NULL;
+                if (mainUi->activeRowset->rowCursor->tileCursor 
+                        != loadCursorTile) 
+                {
+                    pthread_mutex_lock(&offblast->imageStoreLock);
+                    moveImageLoadCursor();
+                    pthread_mutex_unlock(&offblast->imageStoreLock);
+                    loadCursorTile = 
+                        mainUi->activeRowset->rowCursor->tileCursor;
+                }
+
                 // Set the origin Y
                 UiRow *rowToRender = mainUi->activeRowset->rowCursor;
                 rowToRender = rowToRender->nextRow->nextRow;
+                int32_t rowOffset = 2;
                 float desaturate = 0.2;
+
+                // While the grid is scrolling, a cover is only queued once 
+                // its tile has stayed on screen a moment, so tiles that 
+                // fly past don't evict slots or start decodes and downloads. 
+                // Holding a direction leaves a frame or two between moves, 
+                // that doesn't count as settling.
+                static uint32_t lastScrollTick = 0;
+                if (mainUi->horizontalAnimation->animating 
+                        || mainUi->verticalAnimation->animating) 
+                {
+                    lastScrollTick = currentTick;
+                }
+                uint32_t scrolling = 
+                    currentTick - lastScrollTick < COVER_REQUEST_DWELL_MS;
                 float alpha = 1.0;
 
                 float yBase = offblast->winFold - 3*mainUi->boxHeight - 2*mainUi->boxPad;
@@ -4052,13 +4041,14 @@ int main(int argc, char** argv) {
                     int32_t displacement = 0;
                     UiTile *theTile = rowToRender->tileCursor;
                     Image* cursorImage = 
-                        requestImageForTarget(theTile->target, 0);
+                        requestImageForTarget(theTile->target, 0, 0);
 
                     uint32_t theWidth = cursorImage->width;
 
                     Image *imageToShow;
 
                     displacement = theTile->baseX - offblast->winMargin;
+                    int32_t tileOffset = 0;
 
                     if (mainUi->horizontalAnimation->animating != 0 
                             && rowToRender == mainUi->activeRowset->rowCursor) 
@@ -4078,6 +4068,7 @@ int main(int argc, char** argv) {
                     {
                         if (!theTile->previous) break;
                         theTile = theTile->previous;
+                        tileOffset--;
                     }
 
                     while ((int32_t) theTile->baseX - displacement 
@@ -4094,8 +4085,20 @@ int main(int argc, char** argv) {
                         else 
                             imageToShow = &theTile->image;
                         */
+                        if (currentTick - theTile->lastDrawnTick 
+                                > COVER_REQUEST_GAP_MS) 
+                        {
+                            theTile->firstDrawnTick = currentTick;
+                        }
+                        theTile->lastDrawnTick = currentTick;
+
+                        uint32_t settled = !scrolling 
+                            || currentTick - theTile->firstDrawnTick 
+                                >= COVER_REQUEST_DWELL_MS;
+
                         // TODO do we need image to show now?
-                        imageToShow = requestImageForTarget(theTile->target, 1);
+                        imageToShow = requestImageForTarget(theTile->target, 
+                                settled, abs(rowOffset) + abs(tileOffset));
 
                         desaturate = 0.2;
                         alpha = 1.0;
@@ -4116,10 +4119,12 @@ int main(int argc, char** argv) {
 
                         if (!theTile->next) break;
                         theTile = theTile->next;
+                        tileOffset++;
                     }
 
                     yBase += mainUi->boxHeight + mainUi->boxPad;
                     rowToRender = rowToRender->previousRow;
+                    rowOffset--;
                 }
 
                 glUniform1f(offblast->imageDesaturateUni, 0.0f);
@@ -4178,7 +4183,7 @@ int main(int argc, char** argv) {
                     LaunchTarget *target = mainUi->activeRowset->movingToTarget;
                     uint32_t elapsed = SDL_GetTicks() - mainUi->raAchievementFetchTick;
 
-                    if (elapsed > 1600 && strcmp(target->platform, "steam") != 0) {
+                    if (elapsed > 1600 && target->platformId != offblast->steamPlatformId) {
                         // Reset timer FIRST to prevent continuous triggering
                         mainUi->raAchievementFetchTick = SDL_GetTicks();
 
@@ -4190,9 +4195,9 @@ int main(int argc, char** argv) {
                                     // Skip placeholder entries (empty hash)
                                     if (offblast->raGameCache->entries[i].hash[0] != '\0') {
                                         alreadyCached = 1;
-                                        printf("[RA] Game '%s' already verified in cache, skipping\n", target->name);
+                                        printf("[RA] Game '%s' already verified in cache, skipping\n", targetName(target));
                                     } else {
-                                        printf("[RA] Found placeholder entry for '%s', will re-verify\n", target->name);
+                                        printf("[RA] Found placeholder entry for '%s', will re-verify\n", targetName(target));
                                     }
                                     break;
                                 }
@@ -4202,23 +4207,23 @@ int main(int argc, char** argv) {
                         if (!alreadyCached) {
                             if (!offblast->retroAchievementsCache) {
                                 printf("[RA] No RA cache loaded for user\n");
-                            } else if (target->path[0] == '\0') {
-                                printf("[RA] Game '%s' has no ROM path\n", target->name);
+                            } else if (targetPath(target)[0] == '\0') {
+                                printf("[RA] Game '%s' has no ROM path\n", targetName(target));
                             } else {
-                                printf("[RA] Checking '%s' (platform: %s)\n", target->name, target->platform);
+                                printf("[RA] Checking '%s' (platform: %s)\n", targetName(target), targetPlatform(target));
 
                                 // Try fuzzy match against RA cache
-                                int consoleId = platformToConsoleId(target->platform);
+                                int consoleId = platformToConsoleId(targetPlatform(target));
                                 printf("[RA] Console ID: %d\n", consoleId);
 
                                 if (consoleId == RC_CONSOLE_UNKNOWN) {
-                                    printf("[RA] Platform '%s' not supported by RetroAchievements\n", target->platform);
+                                    printf("[RA] Platform '%s' not supported by RetroAchievements\n", targetPlatform(target));
                                 } else {
-                                    uint32_t raGameId = fuzzyMatchRAGame(target->name, target->platform, consoleId);
+                                    uint32_t raGameId = fuzzyMatchRAGame(targetName(target), targetPlatform(target), consoleId);
                                     printf("[RA] Fuzzy match result: %u\n", raGameId);
 
                                     if (raGameId > 0) {
-                                        printf("[RA] Fuzzy match found for '%s', spawning hash verification...\n", target->name);
+                                        printf("[RA] Fuzzy match found for '%s', spawning hash verification...\n", targetName(target));
 
                                         // Show status message
                                         snprintf(offblast->statusMessage, 256, "Verifying RetroAchievements...");
@@ -4231,9 +4236,9 @@ int main(int argc, char** argv) {
                                         ctx->targetSignature = target->targetSignature;
                                         ctx->raGameId = raGameId;
                                         ctx->consoleId = consoleId;
-                                        strncpy(ctx->romPath, target->path, PATH_MAX - 1);
+                                        strncpy(ctx->romPath, targetPath(target), PATH_MAX - 1);
                                         ctx->romPath[PATH_MAX - 1] = '\0';
-                                        strncpy(ctx->gameName, target->name, 255);
+                                        strncpy(ctx->gameName, targetName(target), 255);
                                         ctx->gameName[255] = '\0';
 
                                         pthread_t hashThread;
@@ -4969,7 +4974,7 @@ int main(int argc, char** argv) {
             yOffset -= 100;
 
             char *titleText = 
-                offblast->mainUi.activeRowset->rowCursor->tileCursor->target->name;
+                targetName(offblast->mainUi.activeRowset->rowCursor->tileCursor->target);
 
             uint32_t nameWidth = 
                 getTextLineWidth(titleText, offblast->infoCharData, offblast->infoCodepoints, offblast->infoNumChars);
@@ -4984,7 +4989,7 @@ int main(int argc, char** argv) {
 
             UiTile *theTile =
                 offblast->mainUi.activeRowset->rowCursor->tileCursor;
-            Image *imageToShow = requestImageForTarget(theTile->target, 1);
+            Image *imageToShow = requestImageForTarget(theTile->target, 1, 0);
 
 
             double xPos = offblast->winWidth / 2 - getWidthForScaledImage(
@@ -5017,7 +5022,7 @@ int main(int argc, char** argv) {
                 } else {
                     // For Steam games, just show "Return" (Steam handles resume/stop)
                     int isSteamGame = offblast->playingTarget &&
-                        strcmp(offblast->playingTarget->platform, "steam") == 0;
+                        offblast->playingTarget->platformId == offblast->steamPlatformId;
 
                     if (isSteamGame) {
                         double returnWidth =
@@ -5150,6 +5155,7 @@ int main(int argc, char** argv) {
         pthread_kill(offblast->imageLoadThreads[i], SIGTERM);
     }
     free(offblast->imageLoadThreads);
+    pthread_cond_destroy(&offblast->imageLoadQueued);
     pthread_mutex_destroy(&offblast->imageStoreLock);
 
 
@@ -5354,79 +5360,465 @@ int find_glyph_index(int codepoint, const int *codepoints, int numChars) {
     return -1;  // Not found
 }
 
-char *getCsvField(char *line, int fieldNo)
-{
-    char *cursor = line;
-    char *fieldStart = NULL;
-    char *fieldEnd = NULL;
-    char *fieldString = NULL;
-    int inQuotes = 0;
+void *openGameDbStageWorkerMain(void *arg) {
+    OpenGameDbImport *import = arg;
 
-    for (uint32_t i = 0; i < fieldNo; ++i) {
+    while (1) {
+        pthread_mutex_lock(&import->mutex);
+        uint32_t i = import->nextStage++;
+        pthread_mutex_unlock(&import->mutex);
 
-        fieldStart = cursor;
-        fieldEnd = cursor;
-        inQuotes = 0;
+        if (i >= import->nStages) break;
+        stageOpenGameDbPlatform(offblast->openGameDbPath, &import->stages[i], 
+                &import->pack, &import->rowsParsed);
 
-        while (cursor != NULL) {
+        // Progress is shared by every platform being staged
+        uint32_t rowsParsed = 
+            __atomic_load_n(&import->rowsParsed, __ATOMIC_RELAXED);
+        pthread_mutex_lock(&offblast->loadingState.mutex);
+        if (rowsParsed > offblast->loadingState.progress) {
+            offblast->loadingState.progress = rowsParsed;
+        }
+        pthread_mutex_unlock(&offblast->loadingState.mutex);
+    }
 
-            if (*cursor == '"') {
-                inQuotes++;
-            }
-            else if ((*cursor == ',' && !(inQuotes & 1)) ||
-                    *cursor == '\r' || 
-                    *cursor == '\n' || 
-                    *cursor == '\0') 
-            {
-                fieldEnd = cursor - 1;
-                cursor++;
-                break;
-            }
+    return NULL;
+}
+
+// Stages every platform concurrently, one platform per thread at a time,
+// from ogdb.pack where it still matches the CSV and from the CSV itself
+// otherwise. The calling thread works through them as well.
+void stageOpenGameDbImport(OpenGameDbImport *import) {
+    pthread_mutex_init(&import->mutex, NULL);
+
+    long nThreads = sysconf(_SC_NPROCESSORS_ONLN);
+    if (nThreads < 1) nThreads = 1;
+    if (nThreads > import->nStages) nThreads = import->nStages;
+
+    pthread_t *workers = calloc(nThreads, sizeof(pthread_t));
+    uint32_t nWorkers = 0;
+    for (long i = 1; workers && i < nThreads; i++) {
+        if (pthread_create(&workers[nWorkers], NULL, 
+                    openGameDbStageWorkerMain, import) == 0) 
+        {
+            nWorkers++;
+        }
+    }
+
+    openGameDbStageWorkerMain(import);
+
+    for (uint32_t i = 0; i < nWorkers; i++) {
+        pthread_join(workers[i], NULL);
+    }
+
+    free(workers);
+    pthread_mutex_destroy(&import->mutex);
+}
 
-            cursor++;
+OpenGameDbPlatformState *findOpenGameDbPlatformState(const char *platform) {
+    OpenGameDbPlatformStateFile *file = offblast->openGameDbPlatformFile;
+    for (uint32_t i = 0; i < file->nEntries; ++i) {
+        if (strcmp(file->entries[i].platform, platform) == 0) {
+            return &file->entries[i];
         }
     }
+    return NULL;
+}
 
-    if (*fieldStart == '"') fieldStart++;
-    if (*fieldEnd == '"') fieldEnd--;
+int storeOpenGameDbPlatformState(OpenGameDbStage *stage) {
+    OpenGameDbPlatformState *state = 
+        findOpenGameDbPlatformState(stage->platform);
 
-    uint32_t fieldLength = (fieldEnd - fieldStart) + 1;
+    if (state == NULL) {
+        OpenGameDbPlatformStateFile *file = growDbFileIfNecessary(
+                &offblast->openGameDbPlatformDb, 
+                sizeof(OpenGameDbPlatformState), OFFBLAST_DB_TYPE_FIXED);
+        if (file == NULL) {
+            printf("couldn't grow the opengamedb platform file\n");
+            return 0;
+        }
+        offblast->openGameDbPlatformFile = file;
 
-    fieldString = calloc(1, fieldLength + sizeof(char));
-    memcpy(fieldString, fieldStart, fieldLength);
+        state = &file->entries[file->nEntries++];
+        memset(state, 0, sizeof(OpenGameDbPlatformState));
+        strncpy(state->platform, stage->platform, sizeof(state->platform) - 1);
+    }
 
-    // Keep UTF-8 as-is - rendering code now handles UTF-8 natively
+    state->csvSize = stage->csvSize;
+    state->csvMtime = stage->csvMtime;
+    state->contentHash[0] = stage->contentHash[0];
+    state->contentHash[1] = stage->contentHash[1];
 
-    return fieldString;
+    return 1;
 }
 
-// TODO consider using window event resized
-uint32_t needsReRender(SDL_Window *window) 
-{
-    int32_t newWidth, newHeight;
-    uint32_t updated = 0;
+// Brings a platform's targets back from its shard if it has one. A shard 
+// that's been lost takes the platform's import state with it, so the next 
+// import brings the platform back from the OpenGameDB.
+void loadPlatformShard(const char *platform) {
+    if (!findLaunchTargetShard(&offblast->launchTargetDb, platform)) return;
 
-    MainUi *mainUi = &offblast->mainUi;
+    pthread_mutex_lock(&offblast->steamMetadataLock);
+    int loaded = loadLaunchTargetShard(offblast->configPath, 
+            &offblast->launchTargetDb, &offblast->openGameDbRowDb, 
+            &offblast->descriptionDb, &offblast->descriptionCodec, platform);
 
-    SDL_GetWindowSize(window, &newWidth, &newHeight);
+    offblast->launchTargetFile = 
+        (LaunchTargetFile*) offblast->launchTargetDb.targets.memory;
+    offblast->openGameDbRowFile = 
+        (OpenGameDbRowStateFile*) offblast->openGameDbRowDb.memory;
+    offblast->descriptionFile = 
+        (OffblastBlobFile*) offblast->descriptionDb.memory;
+    pthread_mutex_unlock(&offblast->steamMetadataLock);
 
-    if (newWidth != offblast->winWidth || 
-            newHeight != offblast->winHeight) 
+    if (!loaded && !findLaunchTargetShard(&offblast->launchTargetDb, platform)) 
     {
+        OpenGameDbPlatformState *platformState = 
+            findOpenGameDbPlatformState(platform);
+        if (platformState) {
+            platformState->csvSize = 0;
+            platformState->contentHash[0] = 0;
+            platformState->contentHash[1] = 0;
+        }
+    }
+}
 
-        offblast->winWidth = newWidth;
-        offblast->winHeight= newHeight;
-        glViewport(0, 0, (GLsizei)newWidth, (GLsizei)newHeight);
-        offblast->winFold = newHeight * 0.5;
-        offblast->winMargin = goldenRatioLarge((double) newWidth, 5);
+void loadAllPlatformShards() {
+    LaunchTargetShardFile *shards = 
+        (LaunchTargetShardFile*) offblast->launchTargetDb.shards.memory;
 
-        // 7:5 TODO I don't think this is actually 7:5
-        mainUi->boxHeight = goldenRatioLarge(offblast->winWidth, 4);
-        //TODO REMOVE mainUi->boxWidth = mainUi->boxHeight/5 * 7;
-        mainUi->boxPad = goldenRatioLarge((double) offblast->winWidth, 9);
+    // A damaged shard is dropped by swapping the last one into its place, 
+    // so work down and any that fail are left behind
+    for (uint32_t i = shards->nEntries; i-- > 0;) {
+        if (i >= shards->nEntries) continue;
+        if (shards->entries[i].flags & LAUNCH_TARGET_SHARD_LOADED) continue;
 
-        mainUi->descriptionWidth = 
-            goldenRatioLarge((double) newWidth, 1) - offblast->winMargin;
+        char platform[256];
+        memcpy(platform, shards->entries[i].platform, sizeof(platform));
+        loadPlatformShard(platform);
+    }
+}
+
+// Only platforms with a launcher or a custom list stay in the launch 
+// target files, the rest are sharded until something asks for them. Once 
+// something has, the platform stays loaded from then on. A list that 
+// isn't tied to a platform needs them all.
+void evictUnusedPlatforms() {
+    LaunchTargetDb *db = &offblast->launchTargetDb;
+
+    for (uint32_t i = 0; i < offblast->nCustomLists; ++i) {
+        if (offblast->customLists[i].platform[0] == '\0') {
+            loadAllPlatformShards();
+            return;
+        }
+    }
+
+    uint8_t *evict = calloc(UINT16_MAX + 1, sizeof(uint8_t));
+    if (!evict) return;
+
+    LaunchTargetFile *targets = offblast->launchTargetFile;
+    for (uint32_t i = 0; i < targets->nEntries; ++i) {
+        evict[targets->entries[i].platformId] = 1;
+    }
+
+    evict[0] = 0;
+    evict[offblast->steamPlatformId] = 0;
+    for (uint32_t i = 0; i < offblast->nPlatforms; ++i) {
+        uint16_t id = launchTargetDictLookup(db, offblast->platforms[i]);
+        if (id != LAUNCH_TARGET_DICT_MISSING) evict[id] = 0;
+    }
+    for (uint32_t i = 0; i < offblast->nCustomLists; ++i) {
+        CustomList *list = &offblast->customLists[i];
+        loadPlatformShard(list->platform);
+
+        uint16_t id = launchTargetDictLookup(db, list->platform);
+        if (id != LAUNCH_TARGET_DICT_MISSING) evict[id] = 0;
+    }
+
+    uint32_t nEvicted = 0;
+    if (!evictLaunchTargetShards(offblast->configPath, db, 
+                &offblast->openGameDbRowDb, &offblast->descriptionDb, 
+                &offblast->descriptionCodec, evict, &nEvicted))
+    {
+        printf("couldn't shard every unused platform\n");
+    }
+
+    offblast->launchTargetFile = (LaunchTargetFile*) db->targets.memory;
+    offblast->openGameDbRowFile = 
+        (OpenGameDbRowStateFile*) offblast->openGameDbRowDb.memory;
+
+    if (nEvicted > 0) {
+        printf("Sharded %u targets from platforms with no launcher\n", 
+                nEvicted);
+    }
+
+    free(evict);
+}
+
+// Unlike targetCold, entries for targets added since are created lazily
+OpenGameDbRowState *targetRowState(LaunchTarget *target) {
+    OpenGameDbRowStateFile *rows = offblast->openGameDbRowFile;
+    uint32_t index = target - offblast->launchTargetFile->entries;
+
+    while (rows->nEntries <= index) {
+        rows = growDbFileIfNecessary(&offblast->openGameDbRowDb, 
+                sizeof(OpenGameDbRowState), OFFBLAST_DB_TYPE_FIXED);
+        if (rows == NULL) {
+            printf("couldn't grow the opengamedb row file\n");
+            return NULL;
+        }
+        offblast->openGameDbRowFile = rows;
+
+        memset(&rows->entries[rows->nEntries], 0, sizeof(OpenGameDbRowState));
+        rows->nEntries++;
+    }
+
+    return &rows->entries[index];
+}
+
+int targetDescriptionMatches(LaunchTarget *target, 
+        const CsvField *description) 
+{
+    size_t descLen = csvFieldLength(description);
+    char *stored = decodeDescription(&offblast->descriptionDb, 
+            &offblast->descriptionCodec, target, 
+            targetCold(target)->descriptionOffset);
+    if (stored == NULL) return descLen == 0;
+
+    char *content = malloc(descLen + 1);
+    if (!content) {
+        free(stored);
+        return 0;
+    }
+    csvFieldCopy(description, content);
+    int matches = strlen(stored) == descLen 
+        && memcmp(content, stored, descLen) == 0;
+    free(content);
+    free(stored);
+
+    return matches;
+}
+
+// For targets imported before row hashes were kept
+int stagedTargetMatches(OpenGameDbStage *stage, StagedTarget *staged, 
+        LaunchTarget *target) 
+{
+    return target->ranking == staged->ranking
+        && memcmp(target->date, staged->date, sizeof(target->date)) == 0
+        && strcmp(targetCoverUrl(target), 
+                &stage->strings[staged->coverUrlOffset]) == 0
+        && strcmp(targetId(target), &stage->strings[staged->idOffset]) == 0
+        && targetDescriptionMatches(target, &staged->description);
+}
+
+// The name isn't here as it's part of the signature, a renamed row is a 
+// new target. Returns 0 if the strings couldn't be stored.
+int applyStagedFields(OpenGameDbStage *stage, StagedTarget *staged, 
+        LaunchTarget *target) 
+{
+    target->ranking = staged->ranking;
+    memcpy(&target->date, staged->date, sizeof(target->date));
+    return setTargetCoverUrl(target, &stage->strings[staged->coverUrlOffset])
+        && setTargetId(target, &stage->strings[staged->idOffset]);
+}
+
+// Where the target's description will be once the batch is committed, 
+// appending it only if it has changed. Returns -1 on failure.
+off_t stageTargetDescription(StagedTarget *staged, LaunchTarget *target, 
+        OffblastDbBatch *descriptionBatch) 
+{
+    if (targetDescriptionMatches(target, &staged->description)) {
+        return targetCold(target)->descriptionOffset;
+    }
+    if (csvFieldLength(&staged->description) == 0) return 0;
+
+    return appendDescriptionField(target, &staged->description, 
+            descriptionBatch);
+}
+
+// Brings a platform's targets in line with its staged CSV. Only new rows 
+// and rows whose hash has changed since the last import are written, 
+// paths, launchers and play time are never touched. Targets whose row has 
+// gone are retired rather than removed. New targets and descriptions are 
+// appended in batches that are committed together, and existing targets 
+// are only changed once both have been. Returns 0 if a db file couldn't be 
+// grown or the string heap is full. Existing targets that weren't fully 
+// updated keep their old row hash, so the next import retries them.
+int mergeOpenGameDbStage(OpenGameDbStage *stage, OpenGameDbMergeStats *stats) 
+{
+    // Its targets are updated rather than added again
+    loadPlatformShard(stage->platform);
+
+    LaunchTargetFile *launchTargetFile = offblast->launchTargetFile;
+    uint16_t platformId = launchTargetDictId(&offblast->launchTargetDb, 
+            stage->platform);
+    uint32_t nExisting = launchTargetFile->nEntries;
+
+    // Existing targets that still have a row
+    uint8_t *seen = calloc(nExisting + 1, sizeof(uint8_t));
+    if (!seen) return 0;
+
+    StagedTargetUpdate *updates = 
+        malloc((stage->nTargets + 1) * sizeof(StagedTargetUpdate));
+    if (!updates) {
+        free(seen);
+        return 0;
+    }
+    uint32_t nUpdates = 0;
+
+    OffblastDbBatch targetBatch;
+    beginDbBatch(&targetBatch, &offblast->launchTargetDb.targets, 
+            sizeof(LaunchTarget), OFFBLAST_DB_TYPE_FIXED);
+    OffblastDbBatch descriptionBatch;
+    beginDbBatch(&descriptionBatch, &offblast->descriptionDb, 1, 
+            OFFBLAST_DB_TYPE_BLOB);
+
+    for (uint32_t i = 0; i < stage->nTargets; ++i) {
+        StagedTarget *staged = &stage->targets[i];
+        StagedTargetUpdate *update = &updates[nUpdates];
+        update->staged = staged;
+        update->applyFields = 0;
+        update->descriptionOffset = 0;
+
+        // Staging has already dropped duplicate rows, so nothing added 
+        // by this batch needs finding again
+        int32_t indexOfEntry = launchTargetIndexLookup(
+                &offblast->launchTargetDb, staged->targetSignature);
+
+        if (indexOfEntry == -1) {
+            void *pLaunchTargetMemory = reserveDbBatch(&targetBatch, 1);
+            if (pLaunchTargetMemory == NULL) goto failed;
+            launchTargetFile = (LaunchTargetFile*) pLaunchTargetMemory;
+            offblast->launchTargetFile = launchTargetFile;
+
+            // Not part of the file until the batch is committed, so it can 
+            // be written straight away
+            update->targetIndex = targetBatch.committed + targetBatch.pending;
+            LaunchTarget *target = 
+                &launchTargetFile->entries[update->targetIndex];
+
+            // Zero the entire structure to ensure null-terminated strings
+            resetTarget(target);
+
+            target->targetSignature = staged->targetSignature;
+            target->platformId = platformId;
+            if (!setTargetName(target, &stage->strings[staged->nameOffset])
+                    || !applyStagedFields(stage, staged, target))
+            {
+                goto failed;
+            }
+
+            off_t offset = stageTargetDescription(staged, target, 
+                    &descriptionBatch);
+            if (offset == -1) goto failed;
+            setTargetDescriptionOffset(target, offset);
+
+            targetBatch.pending++;
+            stats->added++;
+        }
+        else {
+            if (seen[indexOfEntry]) continue;
+            seen[indexOfEntry] = 1;
+            update->targetIndex = indexOfEntry;
+            LaunchTarget *target = &launchTargetFile->entries[indexOfEntry];
+
+            OpenGameDbRowState *rowState = targetRowState(target);
+            if (rowState == NULL) goto failed;
+
+            int wasRetired = (target->flags & LAUNCH_TARGET_RETIRED) != 0;
+            if (rowState->rowHash == staged->rowHash && !wasRetired) continue;
+
+            if (rowState->rowHash != 0 
+                    || !stagedTargetMatches(stage, staged, target)) 
+            {
+                update->descriptionOffset = stageTargetDescription(staged, 
+                        target, &descriptionBatch);
+                if (update->descriptionOffset == -1) goto failed;
+                update->applyFields = 1;
+                stats->updated++;
+            }
+        }
+
+        nUpdates++;
+    }
+
+    // Descriptions first so that no committed target points past them
+    if (!commitDbBatch(&descriptionBatch) 
+            || !commitLaunchTargetBatch(&offblast->launchTargetDb, 
+                &targetBatch)) 
+    {
+        goto failed;
+    }
+
+    launchTargetFile = offblast->launchTargetFile;
+    for (uint32_t i = 0; i < nUpdates; ++i) {
+        StagedTargetUpdate *update = &updates[i];
+        LaunchTarget *target = &launchTargetFile->entries[update->targetIndex];
+
+        target->flags &= ~LAUNCH_TARGET_RETIRED;
+        if (update->applyFields) {
+            if (!applyStagedFields(stage, update->staged, target)) {
+                goto failed;
+            }
+            setTargetDescriptionOffset(target, update->descriptionOffset);
+        }
+
+        OpenGameDbRowState *rowState = targetRowState(target);
+        if (rowState == NULL) goto failed;
+        rowState->rowHash = update->staged->rowHash;
+    }
+
+    // Targets that never had a row hash didn't come from this CSV, or came 
+    // from it before hashes were kept, and are left as they are
+    OpenGameDbRowStateFile *rows = offblast->openGameDbRowFile;
+    for (uint32_t i = 0; i < nExisting && i < rows->nEntries; ++i) {
+        LaunchTarget *target = &launchTargetFile->entries[i];
+        if (target->platformId != platformId || seen[i]) continue;
+        if (target->flags & LAUNCH_TARGET_RETIRED) continue;
+        if (rows->entries[i].rowHash == 0) continue;
+
+        target->flags |= LAUNCH_TARGET_RETIRED;
+        stats->retired++;
+    }
+
+    free(updates);
+    free(seen);
+    return 1;
+
+failed:
+    free(updates);
+    free(seen);
+    return 0;
+}
+
+
+// TODO consider using window event resized
+uint32_t needsReRender(SDL_Window *window) 
+{
+    int32_t newWidth, newHeight;
+    uint32_t updated = 0;
+
+    MainUi *mainUi = &offblast->mainUi;
+
+    SDL_GetWindowSize(window, &newWidth, &newHeight);
+
+    if (newWidth != offblast->winWidth || 
+            newHeight != offblast->winHeight) 
+    {
+
+        offblast->winWidth = newWidth;
+        offblast->winHeight= newHeight;
+        glViewport(0, 0, (GLsizei)newWidth, (GLsizei)newHeight);
+        offblast->winFold = newHeight * 0.5;
+        offblast->winMargin = goldenRatioLarge((double) newWidth, 5);
+
+        // 7:5 TODO I don't think this is actually 7:5
+        mainUi->boxHeight = goldenRatioLarge(offblast->winWidth, 4);
+        //TODO REMOVE mainUi->boxWidth = mainUi->boxHeight/5 * 7;
+        mainUi->boxPad = goldenRatioLarge((double) offblast->winWidth, 9);
+
+        mainUi->descriptionWidth = 
+            goldenRatioLarge((double) newWidth, 1) - offblast->winMargin;
 
         // TODO Find a better way to enfoce this
         mainUi->descriptionHeight = goldenRatioLarge(offblast->winWidth, 3);
@@ -5559,6 +5951,10 @@ void changeColumn(uint32_t direction)
                     }
                 }
 
+                prefetchCovers(ui->activeRowset->rowCursor, 
+                        ui->activeRowset->rowCursor->movingToTile, 
+                        0, direction ? 1 : -1);
+
                 ui->horizontalAnimation->startTick = SDL_GetTicks();
                 ui->horizontalAnimation->direction = direction;
                 ui->horizontalAnimation->durationMs = NAVIGATION_MOVE_DURATION;
@@ -5762,6 +6158,10 @@ void changeRow(uint32_t direction)
                     ui->activeRowset->movingToTarget = 
                         ui->activeRowset->rowCursor->previousRow->tileCursor->target;
                 }
+
+                prefetchCovers(ui->activeRowset->movingToRow, 
+                        ui->activeRowset->movingToRow->tileCursor,
+                        direction ? -1 : 1, 0);
             }
         }
     }
@@ -5793,6 +6193,9 @@ void jumpScreen(uint32_t direction)
                         ui->activeRowset->rowCursor->movingToTile = endTile;
                 }
 
+                prefetchCovers(ui->activeRowset->rowCursor, 
+                        ui->activeRowset->rowCursor->movingToTile, 0, 0);
+
                 ui->horizontalAnimation->startTick = SDL_GetTicks();
                 ui->horizontalAnimation->direction = direction;
                 ui->horizontalAnimation->durationMs = NAVIGATION_MOVE_DURATION;
@@ -5897,7 +6300,7 @@ void verticalMoveDone() {
 
 void updateGameInfo() {
         offblast->mainUi.titleText =
-            offblast->mainUi.activeRowset->movingToTarget->name;
+            targetName(offblast->mainUi.activeRowset->movingToTarget);
         updateInfoText();
         updateAchievementsText();
         updateDescriptionText();
@@ -6040,11 +6443,11 @@ char *getCoverPath(LaunchTarget *target) {
     char *homePath = getenv("HOME");
     assert(homePath);
 
-    if (strcmp(target->platform, "steam") == 0) {
+    if (target->platformId == offblast->steamPlatformId) {
         asprintf(&coverArtPath, 
                 "%s/.steam/steam/appcache/librarycache/%s_library_600x900.jpg", 
                 homePath,
-                target->id);
+                targetId(target));
 
         if (access(coverArtPath, F_OK) == -1) {
             //printf("No file on disk: %s\n", coverArtPath);
@@ -6065,13 +6468,13 @@ char *getCoverUrl(LaunchTarget *target) {
 
     char *coverArtUrl;
 
-    if (strcmp(target->platform, "steam") == 0) {
+    if (target->platformId == offblast->steamPlatformId) {
         asprintf(&coverArtUrl, 
                 "https://steamcdn-a.akamaihd.net/steam/apps/%s/library_600x900.jpg", 
-                target->id);
+                targetId(target));
     }
     else {
-        asprintf(&coverArtUrl, "%s", (char *) target->coverUrl);
+        asprintf(&coverArtUrl, "%s", (char *) targetCoverUrl(target));
     }
 
     return coverArtUrl;
@@ -6082,78 +6485,72 @@ void *imageLoadMain(void *arg) {
 
     while (1) {
 
+        // Sleeps until requestImageForTarget queues something
         pthread_mutex_lock(&offblast->imageStoreLock);
-        int32_t index = -1;
-
-        for (uint32_t i = 0; i < IMAGE_STORE_SIZE; ++i) {
-            if (offblast->imageStore[i].targetSignature > 0
-                    && offblast->imageStore[i].state == IMAGE_STATE_QUEUED) 
-            {
-                offblast->imageStore[i].state = IMAGE_STATE_LOADING;
-                index = i;
-                break;
-
-            }
-        }
+        int32_t index = takeImageLoad();
+        uint64_t targetSignature = offblast->imageStore[index].targetSignature;
+        offblast->imageStore[index].state = IMAGE_STATE_LOADING;
+        char *path = calloc(PATH_MAX, sizeof(char));
+        memcpy(path, offblast->imageStore[index].path, PATH_MAX);
         pthread_mutex_unlock(&offblast->imageStoreLock);
 
+        int n, w, h;
+        unsigned char *atlas;
 
-        if (index > -1) {
-            pthread_mutex_lock(&offblast->imageStoreLock);
-            char *path = calloc(PATH_MAX, sizeof(char));
-            memcpy(path, offblast->imageStore[index].path, PATH_MAX);
-            pthread_mutex_unlock(&offblast->imageStoreLock);
+        stbi_set_flip_vertically_on_load(1);
+        atlas = stbi_load(path, &w, &h, &n, 4);
 
-            int n, w, h;
-            unsigned char *atlas;
+        free(path);
 
-            stbi_set_flip_vertically_on_load(1);
-            atlas = stbi_load(path, &w, &h, &n, 4);
+        if(atlas == NULL) {
 
-            free(path);
+            //printf("need to download %d\n", index);
 
-            if(atlas == NULL) {
+            pthread_mutex_lock(&offblast->imageStoreLock);
 
-                //printf("need to download %d\n", index);
+            DownloaderContext *dctx = malloc(sizeof(DownloaderContext));
+            dctx->image = &offblast->imageStore[index];
+            dctx->lock = &offblast->imageStoreLock;
+            offblast->imageStore[index].state = IMAGE_STATE_DOWNLOADING;
 
-                pthread_mutex_lock(&offblast->imageStoreLock);
+            pthread_mutex_unlock(&offblast->imageStoreLock);
 
-                DownloaderContext *dctx = malloc(sizeof(DownloaderContext));
-                dctx->image = &offblast->imageStore[index];
-                dctx->lock = &offblast->imageStoreLock;
-                offblast->imageStore[index].state = IMAGE_STATE_DOWNLOADING;
+            pthread_t downloadThread;
+            pthread_create(
+                    &downloadThread, 
+                    NULL, 
+                    downloadMain, 
+                    (void*)dctx);
+        }
+        else {
+            pthread_mutex_lock(&offblast->imageStoreLock);
 
+            // Forgotten, and maybe handed to another cover, while it loaded
+            if (offblast->imageStore[index].state != IMAGE_STATE_LOADING
+                    || offblast->imageStore[index].targetSignature 
+                        != targetSignature) 
+            {
+                stbi_image_free(atlas);
                 pthread_mutex_unlock(&offblast->imageStoreLock);
-
-                pthread_t downloadThread;
-                pthread_create(
-                        &downloadThread, 
-                        NULL, 
-                        downloadMain, 
-                        (void*)dctx);
                 continue;
             }
-            else {
-                pthread_mutex_lock(&offblast->imageStoreLock);
 
-                size_t atlasSize = w * h * 4;
+            size_t atlasSize = w * h * 4;
 
-                offblast->imageStore[index].atlas = calloc(1, atlasSize);
-                memcpy(offblast->imageStore[index].atlas, atlas, atlasSize);
-                stbi_image_free(atlas);
+            offblast->imageStore[index].atlas = calloc(1, atlasSize);
+            memcpy(offblast->imageStore[index].atlas, atlas, atlasSize);
+            stbi_image_free(atlas);
 
-                offblast->imageStore[index].width = w;
-                offblast->imageStore[index].height = h;
-                offblast->imageStore[index].atlasSize = atlasSize;
-                offblast->imageStore[index].state = IMAGE_STATE_READY;
-                //printf("loaded %"PRIu64"\n", 
-                //        offblast->imageStore[index].targetSignature);
+            offblast->imageStore[index].width = w;
+            offblast->imageStore[index].height = h;
+            offblast->imageStore[index].atlasSize = atlasSize;
+            offblast->imageStore[index].state = IMAGE_STATE_READY;
+            queueImageUpload(index);
+            //printf("loaded %"PRIu64"\n", 
+            //        offblast->imageStore[index].targetSignature);
 
-                pthread_mutex_unlock(&offblast->imageStoreLock);
-            }
+            pthread_mutex_unlock(&offblast->imageStoreLock);
         }
-
-        usleep(16666);
     }
 
     return NULL;
@@ -6310,6 +6707,7 @@ void *downloadMain(void *arg) {
     sleep(1);
     pthread_mutex_lock(ctx->lock);
     ctx->image->state = IMAGE_STATE_QUEUED;
+    queueImageLoad(ctx->image - offblast->imageStore);
     pthread_mutex_unlock(ctx->lock);
     free(ctx);
 
@@ -6582,7 +6980,7 @@ int executeHook(OffblastUi *offblast, const char *hookCmd, const char *statusMsg
             yOffset -= 100;
 
             // Render game name
-            char *titleText = target->name;
+            char *titleText = targetName(target);
             uint32_t nameWidth =
                 getTextLineWidth(titleText, offblast->infoCharData, offblast->infoCodepoints, offblast->infoNumChars);
             renderText(offblast,
@@ -6620,7 +7018,7 @@ int executeHook(OffblastUi *offblast, const char *hookCmd, const char *statusMsg
 
             // Render game cover with blended breathing effect
             UiTile *theTile = offblast->mainUi.activeRowset->rowCursor->tileCursor;
-            Image *imageToShow = requestImageForTarget(theTile->target, 1);
+            Image *imageToShow = requestImageForTarget(theTile->target, 1, 0);
 
             double baseHeight = mainUi->boxHeight;
             double animatedHeight = baseHeight * finalScale;
@@ -6683,22 +7081,22 @@ void launch() {
         offblast->mainUi.activeRowset->rowCursor->tileCursor->target;
 
     // Check if we need to switch Steam accounts before launching
-    if (strcmp(target->platform, "steam") == 0) {
+    if (target->platformId == offblast->steamPlatformId) {
         ensureCorrectSteamAccount();
     }
 
     // Check if this is an uninstalled Steam game
-    if (target->launcherSignature == 0 && strcmp(target->platform, "steam") == 0) {
-        printf("Opening Steam install dialog for %s (id: %s)\n", target->name, target->id);
+    if (target->launcherSignature == 0 && target->platformId == offblast->steamPlatformId) {
+        printf("Opening Steam install dialog for %s (id: %s)\n", targetName(target), targetId(target));
         char *installCmd;
-        asprintf(&installCmd, "steam -bigpicture steam://install/%s", target->id);
+        asprintf(&installCmd, "steam -bigpicture steam://install/%s", targetId(target));
         system(installCmd);
         free(installCmd);
         return;
     }
 
     if (target->launcherSignature == 0) {
-        printf("%s has no launcher \n", target->name);
+        printf("%s has no launcher \n", targetName(target));
     }
 
     int32_t foundIndex = -1;
@@ -6711,7 +7109,7 @@ void launch() {
     }
 
     if (foundIndex == -1) {
-        printf("%s has no launcher\n", target->name);
+        printf("%s has no launcher\n", targetName(target));
         return;
     }
 
@@ -6724,8 +7122,8 @@ void launch() {
     DesktopFile desktop;
     char desktopWorkingDir[PATH_MAX] = {0};
     if (isDesktop) {
-        if (!parseDesktopFile(target->path, &desktop)) {
-            printf("Failed to parse .desktop file: %s\n", target->path);
+        if (!parseDesktopFile(targetPath(target), &desktop)) {
+            printf("Failed to parse .desktop file: %s\n", targetPath(target));
             return;
         }
         if (desktop.path[0] != '\0') {
@@ -6734,8 +7132,8 @@ void launch() {
         }
     }
 
-    if (!isSteam && !isScummvm && !isDesktop && strlen(target->path) == 0) {
-        printf("%s has no launch candidate\n", target->name);
+    if (!isSteam && !isScummvm && !isDesktop && strlen(targetPath(target)) == 0) {
+        printf("%s has no launch candidate\n", targetName(target));
     }
     else {
 
@@ -6775,7 +7173,7 @@ void launch() {
 
         if (isSteam) {
             asprintf(&launchString, "steam -bigpicture steam://rungameid/%s",
-                    target->id);
+                    targetId(target));
         }
         else if (isDesktop) {
             // Use Exec command from .desktop file
@@ -6790,11 +7188,11 @@ void launch() {
             if (savePath) {
                 asprintf(&launchString, "SDL_AUDIODRIVER=alsa scummvm -f --savepath='%s' %s",
                         savePath,
-                        target->path);
+                        targetPath(target));
             }
             else {
                 asprintf(&launchString, "SDL_AUDIODRIVER=alsa scummvm -f %s",
-                        target->path);
+                        targetPath(target));
             }
         }
         else {
@@ -6810,13 +7208,13 @@ void launch() {
             while ((p = strstr(launchString, "%ROM%"))) {
 
                 memmove(
-                        p + strlen(target->path) + 2, 
+                        p + strlen(targetPath(target)) + 2, 
                         p + 5,
                         strlen(p));
 
                 *p = '"';
-                memcpy(p+1, target->path, strlen(target->path));
-                *(p + 1 + strlen(target->path)) = '"';
+                memcpy(p+1, targetPath(target), strlen(targetPath(target)));
+                *(p + 1 + strlen(targetPath(target))) = '"';
 
                 replaceIter++;
                 if (replaceIter >= replaceLimit) {
@@ -6945,7 +7343,7 @@ void pressConfirm(int32_t joystickIndex) {
         if(activeWindowIsOffblast() && !offblast->loadingFlag) {
             // For Steam games, just return to main UI (Steam handles the game)
             int isSteamGame = offblast->playingTarget &&
-                strcmp(offblast->playingTarget->platform, "steam") == 0;
+                offblast->playingTarget->platformId == offblast->steamPlatformId;
 
             if (isSteamGame) {
                 offblast->mode = OFFBLAST_UI_MODE_MAIN;
@@ -6996,6 +7394,7 @@ void pressConfirm(int32_t joystickIndex) {
 
         offblast->player.user = theUser;
         offblast->player.emailHash = emailSignature;
+        setPlayerOwner(theUser);
 
         // Clear previous user's RA cache
         if (offblast->retroAchievementsCache) {
@@ -7187,11 +7586,11 @@ void updateInfoText() {
     if (target->ranking == 999) {
         asprintf(&infoString, "%.4s  |  %s  |  No score",
                 target->date,
-                platformString(target->platform));
+                platformString(targetPlatform(target)));
     } else {
         asprintf(&infoString, "%.4s  |  %s  |  %u%%",
                 target->date,
-                platformString(target->platform),
+                platformString(targetPlatform(target)),
                 target->ranking);
     }
     offblast->mainUi.infoText = infoString;
@@ -7230,7 +7629,7 @@ void updateAchievementsText() {
     if (!target) return;
 
     // Try Steam achievements first
-    if (strcmp(target->platform, "steam") == 0) {
+    if (target->platformId == offblast->steamPlatformId) {
 
     // Check if achievement cache is loaded
     if (!offblast->steamAchievementCache) return;
@@ -7242,7 +7641,7 @@ void updateAchievementsText() {
     }
 
     // mapCache is an array of [appid, data] pairs
-    uint32_t appid = (uint32_t)atoi(target->id);
+    uint32_t appid = (uint32_t)atoi(targetId(target));
     size_t numEntries = json_object_array_length(mapCache);
 
     for (size_t i = 0; i < numEntries; i++) {
@@ -7299,14 +7698,98 @@ void updateAchievementsText() {
     // No cached data - display will be updated when hash verification completes
 }
 
+const char *targetDescription(LaunchTarget *target) {
+    return descriptionText(&offblast->descriptionDb, 
+            &offblast->descriptionCodec, target, 
+            targetCold(target)->descriptionOffset);
+}
+
+// The neighbours' descriptions are decompressed along with the focused 
+// one so that moving a tile over finds them in the cache
 void updateDescriptionText() {
-    if (!offblast->mainUi.activeRowset->numRows) return;
+    UiRowset *rowset = offblast->mainUi.activeRowset;
+    if (!rowset->numRows) return;
+
+    LaunchTarget *target = rowset->movingToTarget;
+    offblast->mainUi.descriptionText = (char*) targetDescription(target);
+
+    UiTile *candidates[] = {
+        rowset->rowCursor ? rowset->rowCursor->movingToTile : NULL,
+        rowset->rowCursor ? rowset->rowCursor->tileCursor : NULL,
+        rowset->movingToRow ? rowset->movingToRow->tileCursor : NULL
+    };
+
+    for (uint32_t i = 0; i < sizeof(candidates) / sizeof(UiTile*); ++i) {
+        UiTile *tile = candidates[i];
+        if (tile == NULL || tile->target != target) continue;
+
+        if (tile->next) targetDescription(tile->next->target);
+        if (tile->previous) targetDescription(tile->previous->target);
+        break;
+    }
+}
+
+
+// Only worth it once a good share of the file is old or duplicate text, 
+// or once there's enough text to train the dictionary a file written 
+// before compression never got
+void compactDescriptionsIfWasteful() {
+    size_t used = offblast->descriptionFile->cursor;
+    size_t live = liveDescriptionBytes(&offblast->descriptionDb, 
+            &offblast->launchTargetDb);
+
+    int wasteful = used >= live + DESCRIPTION_COMPACT_MIN_WASTE 
+        && used - live >= used / 4;
+    int untrained = offblast->descriptionCodec.dictionaryOffset == 0 
+        && live >= DESCRIPTION_TRAIN_MIN_BYTES;
+
+    if (!wasteful && !untrained) return;
 
-    OffblastBlob *descriptionBlob = 
-    (OffblastBlob*) &offblast->descriptionFile->memory[
-       offblast->mainUi.activeRowset->movingToTarget->descriptionOffset];
+    char *descriptionDbPath;
+    asprintf(&descriptionDbPath, "%s/descriptions.bin", offblast->configPath);
+
+    DescriptionCompactionStats stats;
+    if (compactDescriptionDb(descriptionDbPath, &offblast->descriptionDb, 
+                &offblast->descriptionCodec, &offblast->launchTargetDb, 
+                &stats)) 
+    {
+        offblast->descriptionFile = 
+            (OffblastBlobFile*) offblast->descriptionDb.memory;
+
+        // The old text has been unmapped and the cache dropped
+        if (offblast->mainUi.activeRowset) updateDescriptionText();
+
+        printf("Compacted descriptions from %zu to %zu bytes, %u stored, "
+                "%u shared, %u compressed with a %u byte dictionary\n", 
+                stats.bytesBefore, stats.bytesAfter, stats.nStored, 
+                stats.nShared, stats.nCompressed, stats.dictionaryLength);
+    }
+    free(descriptionDbPath);
+}
 
-    offblast->mainUi.descriptionText = descriptionBlob->content;
+// Strings are only ever appended, and nothing is reading them yet on 
+// start, so that's when a heap that's mostly old values, or that's getting 
+// near the 4GB its offsets can reach, is rewritten
+void compactLaunchTargetStringsIfWasteful() {
+    OffblastBlobFile *strings = 
+        (OffblastBlobFile*) offblast->launchTargetDb.strings.memory;
+    size_t used = strings->cursor;
+    size_t live = liveLaunchTargetStringBytes(&offblast->launchTargetDb);
+
+    int wasteful = used >= live + LAUNCH_STRING_COMPACT_MIN_WASTE 
+        && used - live >= used / 4;
+    int nearlyFull = used >= UINT32_MAX / 2 && live < used;
+
+    if (!wasteful && !nearlyFull) return;
+
+    LaunchTargetStringCompactionStats stats;
+    if (compactLaunchTargetStrings(offblast->configPath, 
+                &offblast->launchTargetDb, &stats)) 
+    {
+        printf("Compacted launch target strings from %zu to %zu bytes, "
+                "%u stored, %u shared\n", stats.bytesBefore, 
+                stats.bytesAfter, stats.nStored, stats.nShared);
+    }
 }
 
 
@@ -7332,32 +7815,6 @@ size_t curlWrite(void *contents, size_t size, size_t nmemb, void *userP)
 }
 
 
-int playTimeSort(const void *a, const void *b) {
-
-    PlayTime *ra = (PlayTime*) a;
-    PlayTime *rb = (PlayTime*) b;
-
-    if (ra->msPlayed < rb->msPlayed)
-        return -1;
-    else if (ra->msPlayed > rb->msPlayed)
-        return +1;
-    else
-        return 0;
-}
-
-int lastPlayedSort(const void *a, const void *b) {
-
-    PlayTime *ra = (PlayTime*) a;
-    PlayTime *rb = (PlayTime*) b;
-
-    if (ra->lastPlayed < rb->lastPlayed)
-        return -1;
-    else if (ra->lastPlayed > rb->lastPlayed)
-        return +1;
-    else
-        return 0;
-}
-
 int rankingSort(const void *a, const void *b) {
 
     LaunchTarget **ra = (LaunchTarget**) a;
@@ -7892,13 +8349,12 @@ void updateHomeLists(){
     mainUi->homeRowset->numRows = 0;
     // TODO do I need to free each row's tileset?
 
+    // Both play time rows walk the ranks from the front, they're kept 
+    // sorted as sessions end
+    PlayTimeRankFile *ranks = offblast->playTimeRankFile;
+
     // __ROW__ "Jump back in" 
-    size_t playTimeFileSize = sizeof(PlayTimeFile) + 
-        offblast->playTimeFile->nEntries * sizeof(PlayTime);
-    PlayTimeFile *tempFile = malloc(playTimeFileSize);
-    assert(tempFile);
-    memcpy(tempFile, offblast->playTimeFile, playTimeFileSize);
-    if (offblast->playTimeFile->nEntries) {
+    if (ranks->nEntries) {
 
         uint32_t tileLimit = 25;
         UiTile *tiles = calloc(tileLimit, sizeof(UiTile));
@@ -7906,17 +8362,14 @@ void updateHomeLists(){
 
         uint32_t tileCount = 0;
 
-        qsort(tempFile->entries, tempFile->nEntries, 
-               sizeof(PlayTime),
-               lastPlayedSort);
+        for (uint32_t i = 0; i < ranks->nEntries; ++i) {
 
-        // Sort
-        for (int32_t i = tempFile->nEntries-1; i >= 0; --i) {
+            uint32_t ptIndex = ranks->entries[i].byLastPlayed;
+            if (ptIndex >= offblast->playTimeFile->nEntries) continue;
 
-            PlayTime* pt = (PlayTime*) &tempFile->entries[i];
-            int32_t targetIndex = launchTargetIndexByTargetSignature(
-                    launchTargetFile,
-                    pt->targetSignature);
+            PlayTime* pt = &offblast->playTimeFile->entries[ptIndex];
+            int32_t targetIndex = launchTargetIndexLookup(
+                    &offblast->launchTargetDb, pt->targetSignature);
 
             // Skip if target no longer exists in database
             if (targetIndex == -1) {
@@ -7926,18 +8379,15 @@ void updateHomeLists(){
             LaunchTarget *target = &launchTargetFile->entries[targetIndex];
 
             // Filter Steam games by owner tag
-            if (strcmp(target->platform, "steam") == 0 && target->ownerTag[0] != '\0') {
-                User *currentUser = offblast->player.user;
-                if (currentUser) {
-                    const char *userSteamAccount = getUserCustomField(currentUser, "steam_account_name");
-                    if (!userSteamAccount || strcmp(target->ownerTag, userSteamAccount) != 0) {
-                        continue;  // Not owned by current user
-                    }
-                }
+            if (!targetOwnedByPlayer(target)) {
+                continue;  // Not owned by current user
             }
 
+            if (targetRetired(target)) continue;
+
             // Skip uninstalled games if filter is enabled
-            if (offblast->showInstalledOnly && strlen(target->path) == 0) {
+            if (offblast->showInstalledOnly 
+                    && !(target->flags & LAUNCH_TARGET_INSTALLED)) {
                 continue;
             }
 
@@ -7973,7 +8423,7 @@ void updateHomeLists(){
     }
 
     // __ROW__ "Most played" 
-    if (offblast->playTimeFile->nEntries) {
+    if (ranks->nEntries) {
 
         uint32_t tileLimit = 25;
         UiTile *tiles = calloc(tileLimit, sizeof(UiTile));
@@ -7981,17 +8431,14 @@ void updateHomeLists(){
 
         uint32_t tileCount = 0;
 
-        qsort(tempFile->entries, tempFile->nEntries, 
-               sizeof(PlayTime),
-               playTimeSort);
+        for (uint32_t i = 0; i < ranks->nEntries; ++i) {
 
-        // Sort
-        for (int32_t i = tempFile->nEntries-1; i >= 0; --i) {
+            uint32_t ptIndex = ranks->entries[i].byMsPlayed;
+            if (ptIndex >= offblast->playTimeFile->nEntries) continue;
 
-            PlayTime* pt = (PlayTime*) &tempFile->entries[i];
-            int32_t targetIndex = launchTargetIndexByTargetSignature(
-                    launchTargetFile,
-                    pt->targetSignature);
+            PlayTime* pt = &offblast->playTimeFile->entries[ptIndex];
+            int32_t targetIndex = launchTargetIndexLookup(
+                    &offblast->launchTargetDb, pt->targetSignature);
 
             // Skip if target no longer exists in database
             if (targetIndex == -1) {
@@ -8001,18 +8448,15 @@ void updateHomeLists(){
             LaunchTarget *target = &launchTargetFile->entries[targetIndex];
 
             // Filter Steam games by owner tag
-            if (strcmp(target->platform, "steam") == 0 && target->ownerTag[0] != '\0') {
-                User *currentUser = offblast->player.user;
-                if (currentUser) {
-                    const char *userSteamAccount = getUserCustomField(currentUser, "steam_account_name");
-                    if (!userSteamAccount || strcmp(target->ownerTag, userSteamAccount) != 0) {
-                        continue;  // Not owned by current user
-                    }
-                }
+            if (!targetOwnedByPlayer(target)) {
+                continue;  // Not owned by current user
             }
 
+            if (targetRetired(target)) continue;
+
             // Skip uninstalled games if filter is enabled
-            if (offblast->showInstalledOnly && strlen(target->path) == 0) {
+            if (offblast->showInstalledOnly 
+                    && !(target->flags & LAUNCH_TARGET_INSTALLED)) {
                 continue;
             }
 
@@ -8048,7 +8492,6 @@ void updateHomeLists(){
             mainUi->homeRowset->numRows++;
         }
     }
-    free(tempFile);
 
     // __ROW__ "Your Library"
     uint32_t libraryLength = 0;
@@ -8073,7 +8516,8 @@ void updateHomeLists(){
             if (target->launcherSignature != 0) {
 
                 // Skip uninstalled games if filter is enabled
-                if (offblast->showInstalledOnly && strlen(target->path) == 0) {
+                if (offblast->showInstalledOnly 
+                    && !(target->flags & LAUNCH_TARGET_INSTALLED)) {
                     continue;
                 }
 
@@ -8130,6 +8574,8 @@ void updateHomeLists(){
         }
 
         // Step 1: Collect ALL games for this platform into temporary array
+        uint16_t platformId = launchTargetDictLookup(
+                &offblast->launchTargetDb, offblast->platforms[iPlatform]);
         uint32_t maxPlatformGames = 2000;
         LaunchTarget **platformGames = calloc(maxPlatformGames, sizeof(LaunchTarget*));
         uint32_t numPlatformGames = 0;
@@ -8137,22 +8583,18 @@ void updateHomeLists(){
         for (uint32_t i = 0; i < launchTargetFile->nEntries; ++i) {
             LaunchTarget *target = &launchTargetFile->entries[i];
 
-            if (strcmp(target->platform, offblast->platforms[iPlatform]) == 0) {
+            if (target->platformId == platformId) {
                 // Filter Steam games by owner tag
-                if (strcmp(target->platform, "steam") == 0 && target->ownerTag[0] != '\0') {
-                    // This is a Steam game with an owner - check if it belongs to current user
-                    User *currentUser = offblast->player.user;
-                    if (currentUser) {
-                        const char *userSteamAccount = getUserCustomField(currentUser, "steam_account_name");
-                        if (!userSteamAccount || strcmp(target->ownerTag, userSteamAccount) != 0) {
-                            // Not owned by current user, skip
-                            continue;
-                        }
-                    }
+                if (!targetOwnedByPlayer(target)) {
+                    // Not owned by current user, skip
+                    continue;
                 }
 
+                if (targetRetired(target)) continue;
+
                 // Skip uninstalled games if filter is enabled
-                if (offblast->showInstalledOnly && strlen(target->path) == 0) {
+                if (offblast->showInstalledOnly 
+                    && !(target->flags & LAUNCH_TARGET_INSTALLED)) {
                     continue;
                 }
 
@@ -8162,7 +8604,7 @@ void updateHomeLists(){
                 }
 
                 // Skip games with empty names
-                if (strlen(target->name) == 0) {
+                if (strlen(targetName(target)) == 0) {
                     continue;
                 }
 
@@ -8186,10 +8628,10 @@ void updateHomeLists(){
 
             // Check if we already have this title (case-insensitive)
             for (uint32_t j = 0; j < numDeduped; j++) {
-                if (strcasecmp(dedupedGames[j]->name, candidate->name) == 0) {
+                if (strcasecmp(targetName(dedupedGames[j]), targetName(candidate)) == 0) {
                     // Same title - keep owned version over unowned
-                    int existingOwned = (strlen(dedupedGames[j]->path) > 0);
-                    int candidateOwned = (strlen(candidate->path) > 0);
+                    int existingOwned = (dedupedGames[j]->flags & LAUNCH_TARGET_INSTALLED) != 0;
+                    int candidateOwned = (candidate->flags & LAUNCH_TARGET_INSTALLED) != 0;
 
                     if (candidateOwned && !existingOwned) {
                         // Replace with owned version
@@ -8282,7 +8724,7 @@ void updateHomeLists(){
     mainUi->homeRowset->movingToRow = mainUi->homeRowset->rowCursor;
 
     // Initialize the text to render
-    offblast->mainUi.titleText = mainUi->homeRowset->movingToTarget->name;
+    offblast->mainUi.titleText = targetName(mainUi->homeRowset->movingToTarget);
     updateInfoText();
     updateDescriptionText();
     offblast->mainUi.rowNameText
@@ -8406,6 +8848,25 @@ void buildCustomListRows(MainUi *mainUi, LaunchTargetFile *targetFile) {
 
     printf("[Custom Lists] Building rows for %u lists...\n", offblast->nCustomLists);
 
+    // Platforms in the order they first appear, so that searching all of
+    // them keeps the first platform on a tied score
+    uint16_t *platformIds = calloc(UINT16_MAX + 1, sizeof(uint16_t));
+    uint8_t *platformSeen = calloc(UINT16_MAX + 1, sizeof(uint8_t));
+    uint32_t nPlatformIds = 0;
+    if (!platformIds || !platformSeen) {
+        free(platformIds);
+        free(platformSeen);
+        return;
+    }
+    for (uint32_t i = 0; i < targetFile->nEntries; i++) {
+        uint16_t platformId = targetFile->entries[i].platformId;
+        if (!platformSeen[platformId]) {
+            platformSeen[platformId] = 1;
+            platformIds[nPlatformIds++] = platformId;
+        }
+    }
+    free(platformSeen);
+
     for (uint32_t listIdx = 0; listIdx < offblast->nCustomLists; listIdx++) {
         CustomList *list = &offblast->customLists[listIdx];
 
@@ -8428,16 +8889,16 @@ void buildCustomListRows(MainUi *mainUi, LaunchTargetFile *targetFile) {
             // Search through all targets
             if (platform) {
                 // Platform-specific search
-                targetIdx = launchTargetIndexByNameMatch(targetFile, (char *)gameName, (char *)platform, &matchScore);
+                targetIdx = launchTargetIndexByNameMatch(&offblast->launchTargetDb, (char *)gameName, (char *)platform, &matchScore);
             } else {
                 // Search all platforms for best match
                 float bestScore = 0;
                 int32_t bestIdx = -1;
 
-                for (uint32_t i = 0; i < targetFile->nEntries; i++) {
+                for (uint32_t i = 0; i < nPlatformIds; i++) {
                     float score = 0;
-                    int32_t idx = launchTargetIndexByNameMatch(targetFile, (char *)gameName,
-                                                               targetFile->entries[i].platform, &score);
+                    int32_t idx = launchTargetIndexByNameMatch(&offblast->launchTargetDb, (char *)gameName,
+                                                               launchTargetDictValue(&offblast->launchTargetDb, platformIds[i]), &score);
                     if (idx >= 0 && score > bestScore) {
                         bestScore = score;
                         bestIdx = idx;
@@ -8453,7 +8914,7 @@ void buildCustomListRows(MainUi *mainUi, LaunchTargetFile *targetFile) {
                 tiles[tileCount].target = &targetFile->entries[targetIdx];
                 printf("[Custom Lists]   Matched '%s' (score: %.2f, owned: %s)\n",
                        gameName, matchScore,
-                       targetFile->entries[targetIdx].path[0] ? "yes" : "no");
+                       targetPath(&targetFile->entries[targetIdx])[0] ? "yes" : "no");
                 tileCount++;
             } else {
                 printf("[Custom Lists]   No match for '%s' in OpenGameDB\n", gameName);
@@ -8496,6 +8957,8 @@ void buildCustomListRows(MainUi *mainUi, LaunchTargetFile *targetFile) {
             free(tiles);
         }
     }
+
+    free(platformIds);
 }
 
 void updateResults(uint32_t *launcherSignature) {
@@ -8504,6 +8967,9 @@ void updateResults(uint32_t *launcherSignature) {
 
     changeRowset(mainUi->searchRowset);
 
+    // A search covers every platform, sharded or not
+    if (!launcherSignature) loadAllPlatformShards();
+
     LaunchTargetFile* targetFile = offblast->launchTargetFile;
 
     UiTile *tiles = calloc(IMAGE_STORE_SIZE, sizeof(UiTile));
@@ -8516,7 +8982,7 @@ void updateResults(uint32_t *launcherSignature) {
         uint32_t isMatch = 0;
         if (!launcherSignature
                 && strlen(offblast->searchTerm)
-                && strcasestr(targetFile->entries[i].name, offblast->searchTerm))
+                && strcasestr(targetName(&targetFile->entries[i]), offblast->searchTerm))
         {
             isMatch = 1;
         }
@@ -8528,7 +8994,7 @@ void updateResults(uint32_t *launcherSignature) {
         // Also match uninstalled Steam games (launcherSignature == 0) when viewing Steam
         else if (launcherSignature
                 && targetFile->entries[i].launcherSignature == 0
-                && strcmp(targetFile->entries[i].platform, "steam") == 0)
+                && targetFile->entries[i].platformId == offblast->steamPlatformId)
         {
             // Check if we're viewing the Steam launcher
             for (uint32_t l = 0; l < offblast->nLaunchers; l++) {
@@ -8542,18 +9008,15 @@ void updateResults(uint32_t *launcherSignature) {
 
         if (isMatch) {
             // Filter Steam games by owner tag
-            if (strcmp(targetFile->entries[i].platform, "steam") == 0 && targetFile->entries[i].ownerTag[0] != '\0') {
-                User *currentUser = offblast->player.user;
-                if (currentUser) {
-                    const char *userSteamAccount = getUserCustomField(currentUser, "steam_account_name");
-                    if (!userSteamAccount || strcmp(targetFile->entries[i].ownerTag, userSteamAccount) != 0) {
-                        continue;  // Not owned by current user
-                    }
-                }
+            if (!targetOwnedByPlayer(&targetFile->entries[i])) {
+                continue;  // Not owned by current user
             }
 
+            if (targetRetired(&targetFile->entries[i])) continue;
+
             // Skip uninstalled games if filter is enabled
-            if (offblast->showInstalledOnly && strlen(targetFile->entries[i].path) == 0) {
+            if (offblast->showInstalledOnly 
+                    && !(targetFile->entries[i].flags & LAUNCH_TARGET_INSTALLED)) {
                 continue;
             }
 
@@ -8566,7 +9029,7 @@ void updateResults(uint32_t *launcherSignature) {
             uint32_t slottedIn = 0;
             for (int j=0; j < tileCount; ++j) {
 
-                if (strcoll(targetFile->entries[i].name, tiles[j].target->name) 
+                if (strcoll(targetName(&targetFile->entries[i]), targetName(tiles[j].target)) 
                         <= 0) 
                 {
                     if (tileCount >= 1999) break;
@@ -8611,7 +9074,7 @@ void updateResults(uint32_t *launcherSignature) {
                 // Update the last letter of the previous row
                 if (onTile != 0) {
                     mainUi->searchRowset->rows[onRow].name[21] = 
-                        tiles[onTile-1].target->name[0];
+                        targetName(tiles[onTile-1].target)[0];
                     mainUi->searchRowset->numRows++;
                 }
 
@@ -8623,7 +9086,7 @@ void updateResults(uint32_t *launcherSignature) {
                         mainUi->searchRowset->rows[onRow].name,
                         strlen("Search Results (a to z) "),
                         "Search Results (%c to !)",
-                        tiles[onTile].target->name[0]
+                        targetName(tiles[onTile].target)[0]
                         );
 
 
@@ -8648,7 +9111,7 @@ void updateResults(uint32_t *launcherSignature) {
                 tiles[onTile].next = &tiles[onTile+1];
             else {
                 mainUi->searchRowset->rows[onRow].name[21] = 
-                    tiles[onTile].target->name[0];
+                    targetName(tiles[onTile].target)[0];
                 tiles[onTile].next = NULL;
             }
         }
@@ -8720,6 +9183,22 @@ void loadPlaytimeFile() {
         (PlayTimeFile*) playTimeDb.memory;
     offblast->playTimeDb = playTimeDb;
     free(playTimeDbPath);
+
+    char *playTimeRankDbPath;
+    asprintf(&playTimeRankDbPath, "%s/%s.playranks", 
+            offblast->playtimePath, email);
+
+    OffblastDbFile playTimeRankDb = {0};
+    if (!initPlayTimeRanks(playTimeRankDbPath, &playTimeRankDb, 
+                offblast->playTimeFile))
+    {
+        printf("couldn't initialize the play time ranks, exiting\n");
+        exit(1);
+    }
+    offblast->playTimeRankFile =
+        (PlayTimeRankFile*) playTimeRankDb.memory;
+    offblast->playTimeRankDb = playTimeRankDb;
+    free(playTimeRankDbPath);
 }
 
 void loadRACredentialsFromUser() {
@@ -8841,6 +9320,13 @@ void killRunningGame() {
     pt->msPlayed += (afterTick - offblast->startPlayTick);
     pt->lastPlayed = (uint32_t)time(NULL);
 
+    if (!updatePlayTimeRank(&offblast->playTimeRankDb, 
+                offblast->playTimeFile, 
+                pt - offblast->playTimeFile->entries)) 
+    {
+        printf("Couldn't update the play time ranks\n");
+    }
+
     // Find the launcher for this target to execute post-hook
     Launcher *theLauncher = NULL;
     for (uint32_t i = 0; i < offblast->nLaunchers; ++i) {
@@ -8862,7 +9348,7 @@ void killRunningGame() {
         // For desktop launchers, check .desktop file for per-game hooks
         if (strcmp(theLauncher->type, "desktop") == 0) {
             DesktopFile desktop;
-            if (parseDesktopFile(target->path, &desktop)) {
+            if (parseDesktopFile(targetPath(target), &desktop)) {
                 if (desktop.postHook[0] != '\0') {
                     postHookCmd = desktop.postHook;
                     postHookStatus = desktop.postHookStatus;
@@ -8925,7 +9411,7 @@ void pressGuide() {
     {
         // Let Steam Big Picture handle guide button for Steam games
         if (offblast->playingTarget &&
-            strcmp(offblast->playingTarget->platform, "steam") == 0) {
+            offblast->playingTarget->platformId == offblast->steamPlatformId) {
             return;
         }
 
@@ -8976,7 +9462,7 @@ void rescrapeCurrentLauncher(int deleteAllCovers) {
 
     LaunchTarget *currentTarget = mainUi->activeRowset->rowCursor->tileCursor->target;
     printf("Current target: %s (platform: %s, launcher sig: %u)\n",
-           currentTarget->name, currentTarget->platform, currentTarget->launcherSignature);
+           targetName(currentTarget), targetPlatform(currentTarget), currentTarget->launcherSignature);
 
     // Check if target has a launcher signature
     if (currentTarget->launcherSignature == 0) {
@@ -9008,7 +9494,7 @@ void rescrapeCurrentLauncher(int deleteAllCovers) {
         uint32_t steamCount = 0;
         LaunchTargetFile *targetFile = offblast->launchTargetFile;
         for (uint32_t i = 0; i < targetFile->nEntries; i++) {
-            if (strcmp(targetFile->entries[i].platform, "steam") == 0) {
+            if (targetFile->entries[i].platformId == offblast->steamPlatformId) {
                 steamCount++;
             }
         }
@@ -9023,7 +9509,7 @@ void rescrapeCurrentLauncher(int deleteAllCovers) {
 
         uint32_t updated = 0;
         for (uint32_t i = 0; i < targetFile->nEntries; i++) {
-            if (strcmp(targetFile->entries[i].platform, "steam") != 0) continue;
+            if (targetFile->entries[i].platformId != offblast->steamPlatformId) continue;
 
             LaunchTarget *target = &targetFile->entries[i];
 
@@ -9031,12 +9517,12 @@ void rescrapeCurrentLauncher(int deleteAllCovers) {
             if (deleteAllCovers) {
                 memset(target->date, 0, sizeof(target->date));
                 target->ranking = 0;
-                target->descriptionOffset = 0;
+                setTargetDescriptionOffset(target, 0);
             }
 
             // Fetch fresh metadata
-            uint32_t appid = (uint32_t)atoi(target->id);
-            printf("Fetching metadata for: %s (%u)\n", target->name, appid);
+            uint32_t appid = (uint32_t)atoi(targetId(target));
+            printf("Fetching metadata for: %s (%u)\n", targetName(target), appid);
 
             SteamMetadata *meta = fetchSteamGameMetadata(appid);
             if (meta) {
@@ -9049,7 +9535,7 @@ void rescrapeCurrentLauncher(int deleteAllCovers) {
                     target->ranking = 999;  // No score available
                 }
                 if (meta->description) {
-                    target->descriptionOffset = writeDescriptionBlob(target, meta->description);
+                    setTargetDescriptionOffset(target, writeDescriptionBlob(target, meta->description));
                 }
                 printf("  Date: %s, Score: %u\n", meta->date, meta->score);
                 freeSteamMetadata(meta);
@@ -9117,14 +9603,14 @@ void rescrapeCurrentLauncher(int deleteAllCovers) {
                 }
 
                 // Clear cover URL - this will force re-download
-                memset(target->coverUrl, 0, PATH_MAX);
+                setTargetCoverUrl(target, "");
 
                 // Clear other metadata that comes from OpenGameDB
                 memset(target->date, 0, sizeof(target->date));
                 target->ranking = 0;
-                target->descriptionOffset = 0;
+                setTargetDescriptionOffset(target, 0);
 
-                printf("  Cleared metadata for: %s\n", target->name);
+                printf("  Cleared metadata for: %s\n", targetName(target));
             }
         }
     } else {
@@ -9135,18 +9621,18 @@ void rescrapeCurrentLauncher(int deleteAllCovers) {
                 homePath, currentTarget->targetSignature);
         if (access(coverPath, F_OK) == 0) {
             if (unlink(coverPath) == 0) {
-                printf("  Deleted cover for current game: %s\n", currentTarget->name);
+                printf("  Deleted cover for current game: %s\n", targetName(currentTarget));
             } else {
                 printf("  Failed to delete cover: %s\n", coverPath);
             }
         }
 
         // Clear metadata for ONLY the current game
-        memset(currentTarget->coverUrl, 0, PATH_MAX);
+        setTargetCoverUrl(currentTarget, "");
         memset(currentTarget->date, 0, sizeof(currentTarget->date));
         currentTarget->ranking = 0;
-        currentTarget->descriptionOffset = 0;
-        printf("  Cleared metadata for: %s\n", currentTarget->name);
+        setTargetDescriptionOffset(currentTarget, 0);
+        printf("  Cleared metadata for: %s\n", targetName(currentTarget));
 
         affectedCount = 1;  // Only updating one game
     }
@@ -9168,31 +9654,24 @@ void rescrapeCurrentLauncher(int deleteAllCovers) {
     snprintf(csvPath, PATH_MAX, "%s/%s.csv", openGameDbPath, targetLauncher->platform);
     printf("Reading CSV: %s\n", csvPath);
 
-    FILE *csvFile = fopen(csvPath, "r");
-    if (!csvFile) {
+    CsvReader csvReader;
+    if (!openCsvReader(csvPath, &csvReader)) {
         printf("ERROR: Could not open CSV file: %s\n", csvPath);
         return;
     }
 
     // Read and process CSV
-    char *csvLine = NULL;
-    size_t csvLineLength = 0;
-    ssize_t csvBytesRead;
+    OpenGameDbRow row = {0};
     uint32_t rowCount = 0;
     uint32_t matchCount = 0;
 
-    while ((csvBytesRead = getline(&csvLine, &csvLineLength, csvFile)) != -1) {
+    while (readOpenGameDbRow(&csvReader, &row)) {
         if (rowCount == 0) {
             rowCount++;
             continue; // Skip header
         }
 
-        // Parse CSV fields
-        char *gameName = getCsvField(csvLine, 1);
-        if (!gameName) {
-            rowCount++;
-            continue;
-        }
+        char *gameName = row.name;
 
         // Use the same matching logic as initial scan
         // Create signature from platform + gameName to find the right target
@@ -9203,13 +9682,8 @@ void rescrapeCurrentLauncher(int deleteAllCovers) {
         lmmh_x64_128(gameSeed, strlen(gameSeed), 33, targetSignature);
 
         // Find the target with this exact signature
-        int32_t targetIndex = -1;
-        for (uint32_t i = 0; i < targetFile->nEntries; i++) {
-            if (targetFile->entries[i].targetSignature == targetSignature[0]) {
-                targetIndex = i;
-                break;
-            }
-        }
+        int32_t targetIndex = launchTargetIndexLookup(
+                &offblast->launchTargetDb, targetSignature[0]);
 
         if (targetIndex >= 0) {
             LaunchTarget *target = &targetFile->entries[targetIndex];
@@ -9220,83 +9694,53 @@ void rescrapeCurrentLauncher(int deleteAllCovers) {
                 // If single-game mode, only update the current game
                 if (!deleteAllCovers && target->targetSignature != currentTarget->targetSignature) {
                     // Skip this game - we only want to update the current one
-                    free(gameName);
+                    free(gameSeed);
                     rowCount++;
                     continue;
                 }
 
                 printf("  Match found by signature: %s -> %s (sig: %"PRIu64")\n",
-                       target->name, gameName, targetSignature[0]);
+                       targetName(target), gameName, targetSignature[0]);
 
                 // Update metadata from CSV
-                char *gameDate = getCsvField(csvLine, 2);
-                char *scoreString = getCsvField(csvLine, 3);
-                char *metaScoreString = getCsvField(csvLine, 4);
-                char *description = getCsvField(csvLine, 6);
-                char *coverArtUrl = getCsvField(csvLine, 7);
-                char *gameId = getCsvField(csvLine, 8);
+                char *gameDate = row.date;
+                char *scoreString = row.score;
+                char *metaScoreString = row.metaScore;
+                char *coverArtUrl = row.coverUrl;
+                char *gameId = row.id;
 
                 // Update cover URL
-                if (coverArtUrl && strlen(coverArtUrl) > 0) {
-                    strncpy(target->coverUrl, coverArtUrl, PATH_MAX - 1);
+                if (strlen(coverArtUrl) > 0 
+                        && setTargetCoverUrl(target, coverArtUrl)) 
+                {
                     printf("    Updated cover URL: %s\n", coverArtUrl);
                 }
 
                 // Update date
-                if (gameDate) {
-                    if (strlen(gameDate) == 10) {
-                        memcpy(target->date, gameDate, 10);
-                    } else if (strlen(gameDate) == 4 && strtod(gameDate, NULL)) {
-                        memcpy(target->date, gameDate, 4);
-                    }
+                if (strlen(gameDate) == 10) {
+                    memcpy(target->date, gameDate, 10);
+                } else if (strlen(gameDate) == 4 && strtod(gameDate, NULL)) {
+                    memcpy(target->date, gameDate, 4);
                 }
 
                 // Update score/ranking
-                float score = -1;
-                if (scoreString && strlen(scoreString) != 0) {
-                    float gfScore = atof(scoreString);
-                    // Validate: must be numeric and in valid range
-                    if (gfScore > 0 && gfScore <= 5.0) {
-                        score = gfScore * 2 * 10;
-                    }
-                }
-                if (metaScoreString && strlen(metaScoreString) != 0) {
-                    float metaScore = atof(metaScoreString);
-                    // Validate: must be numeric and in valid range
-                    if (metaScore > 0 && metaScore <= 100) {
-                        if (score == -1) {
-                            score = metaScore;
-                        } else {
-                            score = (score + metaScore) / 2;
-                        }
-                    }
-                }
-                // Set sentinel value if no valid score
-                if (score == -1) {
-                    target->ranking = 999;
-                } else {
-                    target->ranking = (uint32_t)round(score);
-                }
+                target->ranking = openGameDbRanking(scoreString, 
+                        metaScoreString);
 
                 // Update game ID
-                if (gameId && strlen(gameId) > 0) {
-                    strncpy(target->id, gameId, OFFBLAST_NAME_MAX - 1);
+                if (strlen(gameId) > 0) {
+                    setTargetId(target, gameId);
                 }
 
                 // Update description
-                if (description && strlen(description) > 0) {
-                    target->descriptionOffset = writeDescriptionBlob(target, description);
-                    printf("    Updated description (%zu bytes)\n", strlen(description));
+                if (csvFieldLength(&row.description) > 0
+                        && storeDescriptionField(target, &row.description, 
+                            NULL)) 
+                {
+                    printf("    Updated description (%u bytes)\n", 
+                            csvFieldLength(&row.description));
                 }
 
-                // Clean up
-                free(gameDate);
-                free(scoreString);
-                free(metaScoreString);
-                free(description);
-                free(coverArtUrl);
-                free(gameId);
-
                 matchCount++;
                 offblast->rescrapeProcessed = matchCount; // Update progress
 
@@ -9304,21 +9748,19 @@ void rescrapeCurrentLauncher(int deleteAllCovers) {
                 if (!deleteAllCovers) {
                     printf("Found and updated current game, stopping CSV scan\n");
                     free(gameSeed);
-                    free(gameName);
-                    free(csvLine);
-                    fclose(csvFile);
+                    free(row.buffer);
+                    closeCsvReader(&csvReader);
                     goto skip_csv_cleanup;
                 }
             }
         }
 
         free(gameSeed);
-        free(gameName);
         rowCount++;
     }
 
-    free(csvLine);
-    fclose(csvFile);
+    free(row.buffer);
+    closeCsvReader(&csvReader);
 
 skip_csv_cleanup:
 
@@ -9338,21 +9780,19 @@ skip_csv_cleanup:
     // Force image store to reload covers for affected targets
     printf("Clearing image cache for affected games...\n");
     pthread_mutex_lock(&offblast->imageStoreLock);
-    for (uint32_t i = 0; i < IMAGE_STORE_SIZE; i++) {
-        for (uint32_t j = 0; j < targetFile->nEntries; j++) {
-            if (targetFile->entries[j].launcherSignature == currentTarget->launcherSignature &&
-                offblast->imageStore[i].targetSignature == targetFile->entries[j].targetSignature) {
-                // Mark as cold to force reload
-                offblast->imageStore[i].state = IMAGE_STATE_COLD;
-                offblast->imageStore[i].targetSignature = 0;
-                if (offblast->imageStore[i].textureHandle) {
-                    glDeleteTextures(1, &offblast->imageStore[i].textureHandle);
-                    offblast->imageStore[i].textureHandle = 0;
-                    offblast->numLoadedTextures--;
-                }
-                printf("  Cleared image cache for signature %"PRIu64"\n",
-                       targetFile->entries[j].targetSignature);
-            }
+    for (uint32_t j = 0; j < targetFile->nEntries; j++) {
+        if (targetFile->entries[j].launcherSignature 
+                != currentTarget->launcherSignature) 
+        {
+            continue;
+        }
+
+        int32_t slot = findImageSlot(targetFile->entries[j].targetSignature);
+        if (slot != IMAGE_SLOT_NONE) {
+            // Mark as cold to force reload
+            forgetImageSlot(slot);
+            printf("  Cleared image cache for signature %"PRIu64"\n",
+                   targetFile->entries[j].targetSignature);
         }
     }
     pthread_mutex_unlock(&offblast->imageStoreLock);
@@ -9759,26 +10199,375 @@ uint32_t pushToRomList(RomFoundList *list, char *path, char *name, char *id) {
     return 1;
 }
 
-uint32_t romListContentSig(RomFoundList *list) {
-    uint32_t contentSignature = 0;
-    lmmh_x86_32(list->items, list->numItems * sizeof(RomFound),
-            33, &contentSignature);
-
-    return contentSignature;
-}
-
 void freeRomList(RomFoundList *list) {
     free(list->items);
     list->items = NULL;
     free(list);
 }
 
-// Steam API game entry
-typedef struct SteamGame {
-    uint32_t appid;
-    char name[256];
-    uint32_t playtime_forever;
-    uint8_t installed;
+// Shared by the ROM match workers, only nextItem changes once they start
+typedef struct RomMatchBatch {
+    Launcher *launcher;
+    RomFoundList *list;
+    LaunchTargetNameIndex *nameIndex;
+    char **searchStrings;
+    uint8_t *cached;
+    RomMatch *matches;
+    uint32_t nextItem;
+    pthread_mutex_t mutex;
+} RomMatchBatch;
+
+typedef struct RomMatchCacheKey {
+    uint64_t pathHash;
+    uint32_t entryIndex;
+} RomMatchCacheKey;
+
+// Stored name from pattern scanning, otherwise the file name without 
+// its tags and extension
+char *romSearchString(RomFound *rom) {
+    if (rom->name[0] != '\0') {
+        printf("Using stored name for matching: %s\n", rom->name);
+        return strdup(rom->name);
+    }
+
+    char *startOfFileName = strrchr(rom->path, '/');
+    startOfFileName = startOfFileName ? startOfFileName + 1 : rom->path;
+    char *searchString = strdup(startOfFileName);
+
+    char *ext = strchr(searchString, '(');
+
+    if (ext == NULL) ext = strrchr(searchString, '.');
+    if (ext != NULL) {
+        *ext = '\0';
+        if (ext > searchString && *(ext-1) == ' ') *(ext-1) = '\0';
+    }
+
+    return searchString;
+}
+
+void matchRom(RomMatchBatch *batch, uint32_t j) {
+    if (batch->cached[j]) return;
+
+    Launcher *theLauncher = batch->launcher;
+    char *searchString = batch->searchStrings[j];
+    float matchScore = 0;
+
+    printf("\nDEBUG: Searching for ROM: %s\n", searchString);
+    printf("       Platform: %s\n", theLauncher->platform);
+    printf("       Match field: %s\n", theLauncher->matchField);
+
+    int32_t indexOfEntry = launchTargetIndexByFieldMatch(
+            &offblast->launchTargetDb,
+            batch->nameIndex,
+            theLauncher->matchField,
+            searchString,
+            theLauncher->platform,
+            &matchScore);
+
+    // Try with converted numerals if no match found or poor match
+    if ((indexOfEntry == -1 || matchScore < 1.0) && strcmp(theLauncher->matchField, "title") == 0) {
+        char *convertedName = convertNumeralInGameName(searchString);
+        if (convertedName) {
+            printf("       Trying with converted numerals: %s\n", convertedName);
+            float convertedMatchScore = 0;
+            int32_t convertedIndex = launchTargetIndexByFieldMatch(
+                    &offblast->launchTargetDb,
+                    batch->nameIndex,
+                    theLauncher->matchField,
+                    convertedName,
+                    theLauncher->platform,
+                    &convertedMatchScore);
+
+            // Use converted version if it's better
+            if (convertedIndex > -1 && convertedMatchScore > matchScore) {
+                printf("       Converted version matched better: score %f vs %f\n",
+                       convertedMatchScore, matchScore);
+                indexOfEntry = convertedIndex;
+                matchScore = convertedMatchScore;
+            }
+            free(convertedName);
+        }
+    }
+
+    batch->matches[j].indexOfEntry = indexOfEntry;
+    batch->matches[j].matchScore = matchScore;
+}
+
+void *romMatchWorkerMain(void *arg) {
+    RomMatchBatch *batch = (RomMatchBatch *) arg;
+
+    while (1) {
+        pthread_mutex_lock(&batch->mutex);
+        uint32_t start = batch->nextItem;
+        if (start < batch->list->numItems) batch->nextItem += ROM_MATCH_CHUNK;
+        pthread_mutex_unlock(&batch->mutex);
+
+        if (start >= batch->list->numItems) break;
+
+        uint32_t end = start + ROM_MATCH_CHUNK;
+        if (end > batch->list->numItems) end = batch->list->numItems;
+
+        for (uint32_t j = start; j < end; j++) {
+            matchRom(batch, j);
+        }
+    }
+
+    return NULL;
+}
+
+// The CSV is the only thing that changes a platform's targets, so a
+// cached match is good for as long as it looks the same
+uint64_t openGameDbCsvStamp(const char *platform) {
+    uint64_t stamp[3] = {0, 0, 0};
+
+    if (offblast->openGameDbPath) {
+        char *csvPath;
+        asprintf(&csvPath, "%s/%s.csv", offblast->openGameDbPath, platform);
+
+        struct stat sb;
+        if (stat(csvPath, &sb) == 0) {
+            stamp[0] = sb.st_size;
+            stamp[1] = sb.st_mtim.tv_sec;
+            stamp[2] = sb.st_mtim.tv_nsec;
+        }
+        free(csvPath);
+    }
+
+    uint64_t hash[2] = {0, 0};
+    lmmh_x64_128(stamp, sizeof(stamp), 33, hash);
+    return hash[0];
+}
+
+uint64_t romSearchHash(const char *matchField, const char *searchString) {
+    char *key;
+    asprintf(&key, "%s\n%s", matchField, searchString);
+
+    uint64_t hash[2] = {0, 0};
+    lmmh_x64_128(key, strlen(key), 33, hash);
+    free(key);
+
+    return hash[0];
+}
+
+int compareRomMatchCacheKeys(const void *a, const void *b) {
+    uint64_t left = ((const RomMatchCacheKey*) a)->pathHash;
+    uint64_t right = ((const RomMatchCacheKey*) b)->pathHash;
+    return (left > right) - (left < right);
+}
+
+void pruneRomMatchCache(uint32_t *launcherSignatures, 
+        uint32_t nLauncherSignatures) 
+{
+    RomMatchCacheFile *cache = offblast->romMatchCache;
+    if (!cache) return;
+
+    uint32_t kept = 0;
+    for (uint32_t i = 0; i < cache->nEntries; i++) {
+        for (uint32_t j = 0; j < nLauncherSignatures; j++) {
+            if (cache->entries[i].launcherSignature == launcherSignatures[j]) {
+                cache->entries[kept++] = cache->entries[i];
+                break;
+            }
+        }
+    }
+
+    if (kept != cache->nEntries) {
+        printf("Dropped %u ROM matches for removed launchers\n", 
+                cache->nEntries - kept);
+    }
+    cache->nEntries = kept;
+}
+
+// Finds the best target for every ROM in the list on a pool of threads.
+// Matching only reads the target table, so callers apply the results
+// (path, launcher and score) themselves afterwards, in list order. ROMs
+// with a still valid entry in the match cache skip the matcher entirely.
+RomMatch *matchRomList(Launcher *theLauncher, RomFoundList *list) {
+    RomMatchBatch batch = {0};
+    batch.launcher = theLauncher;
+    batch.list = list;
+    batch.matches = calloc(list->numItems, sizeof(RomMatch));
+    batch.searchStrings = calloc(list->numItems, sizeof(char*));
+    batch.cached = calloc(list->numItems, sizeof(uint8_t));
+
+    uint64_t *pathHashes = calloc(list->numItems, sizeof(uint64_t));
+    uint64_t *fileSizes = calloc(list->numItems, sizeof(uint64_t));
+    uint64_t *searchHashes = calloc(list->numItems, sizeof(uint64_t));
+
+    RomMatchCacheFile *cache = offblast->romMatchCache;
+    RomMatchCacheKey *cacheKeys = 
+        calloc(cache ? cache->nEntries + 1 : 1, sizeof(RomMatchCacheKey));
+
+    if (!batch.matches || !batch.searchStrings || !batch.cached 
+            || !pathHashes || !fileSizes || !searchHashes || !cacheKeys) 
+    {
+        free(batch.matches);
+        free(batch.searchStrings);
+        free(batch.cached);
+        free(pathHashes);
+        free(fileSizes);
+        free(searchHashes);
+        free(cacheKeys);
+        return NULL;
+    }
+
+    // This launcher's cache entries, sorted for lookups by path
+    uint32_t nCacheKeys = 0;
+    for (uint32_t i = 0; cache && i < cache->nEntries; i++) {
+        if (cache->entries[i].launcherSignature == theLauncher->signature) {
+            cacheKeys[nCacheKeys].pathHash = cache->entries[i].pathHash;
+            cacheKeys[nCacheKeys].entryIndex = i;
+            nCacheKeys++;
+        }
+    }
+    qsort(cacheKeys, nCacheKeys, sizeof(RomMatchCacheKey), 
+            compareRomMatchCacheKeys);
+
+    uint64_t csvStamp = openGameDbCsvStamp(theLauncher->platform);
+    uint32_t nCached = 0;
+
+    for (uint32_t j = 0; j < list->numItems; j++) {
+        RomFound *rom = &list->items[j];
+        struct stat sb;
+
+        batch.searchStrings[j] = romSearchString(rom);
+        pathHashes[j] = romPathHash(rom->path);
+        fileSizes[j] = stat(rom->path, &sb) == 0 ? sb.st_size : 0;
+        searchHashes[j] = romSearchHash(theLauncher->matchField, 
+                batch.searchStrings[j]);
+
+        RomMatchCacheKey key = {pathHashes[j], 0};
+        RomMatchCacheKey *found = bsearch(&key, cacheKeys, nCacheKeys, 
+                sizeof(RomMatchCacheKey), compareRomMatchCacheKeys);
+        if (!found) continue;
+
+        RomMatchCacheEntry *entry = &cache->entries[found->entryIndex];
+        if (entry->fileSize != fileSizes[j] 
+                || entry->searchHash != searchHashes[j]
+                || entry->csvStamp != csvStamp) 
+        {
+            continue;
+        }
+
+        int32_t indexOfEntry = -1;
+        if (entry->targetSignature != 0) {
+            indexOfEntry = launchTargetIndexLookup(
+                    &offblast->launchTargetDb, entry->targetSignature);
+            if (indexOfEntry == -1) continue;
+        }
+
+        batch.matches[j].indexOfEntry = indexOfEntry;
+        batch.matches[j].matchScore = 
+            indexOfEntry > -1 ? entry->matchScore : 0;
+        batch.cached[j] = 1;
+        nCached++;
+    }
+
+    pthread_mutex_init(&batch.mutex, NULL);
+
+    // Built once for the whole batch, matching falls back to a full scan 
+    // per ROM if this fails
+    if (nCached < list->numItems 
+            && strcmp(theLauncher->matchField, "title_id") != 0) 
+    {
+        batch.nameIndex = newLaunchTargetNameIndex(
+                &offblast->launchTargetDb, theLauncher->platform);
+    }
+
+    long nThreads = sysconf(_SC_NPROCESSORS_ONLN);
+    uint32_t nChunks = (list->numItems + ROM_MATCH_CHUNK - 1) / ROM_MATCH_CHUNK;
+    if (nCached == list->numItems) nThreads = 1;
+    if (nThreads < 1) nThreads = 1;
+    if (nThreads > nChunks) nThreads = nChunks;
+
+    // The calling thread works through the batch as well
+    pthread_t *workers = calloc(nThreads, sizeof(pthread_t));
+    uint32_t nWorkers = 0;
+    for (long i = 1; workers && i < nThreads; i++) {
+        if (pthread_create(&workers[nWorkers], NULL, 
+                    romMatchWorkerMain, &batch) == 0) 
+        {
+            nWorkers++;
+        }
+    }
+
+    romMatchWorkerMain(&batch);
+
+    for (uint32_t i = 0; i < nWorkers; i++) {
+        pthread_join(workers[i], NULL);
+    }
+
+    printf("Matched %u ROMs for %s on %u threads, %u from the cache\n", 
+            list->numItems, theLauncher->platform, nWorkers + 1, nCached);
+
+    // Remember the new results, overwriting this launcher's stale entries
+    LaunchTargetFile *targetFile = offblast->launchTargetFile;
+    OffblastDbBatch cacheBatch;
+    if (offblast->romMatchCache) {
+        beginDbBatch(&cacheBatch, &offblast->romMatchDb, 
+                sizeof(RomMatchCacheEntry), OFFBLAST_DB_TYPE_FIXED);
+    }
+
+    for (uint32_t j = 0; offblast->romMatchCache && j < list->numItems; j++) {
+        if (batch.cached[j]) continue;
+
+        RomMatchCacheKey key = {pathHashes[j], 0};
+        RomMatchCacheKey *found = bsearch(&key, cacheKeys, nCacheKeys, 
+                sizeof(RomMatchCacheKey), compareRomMatchCacheKeys);
+
+        RomMatchCacheEntry *entry;
+        if (found) {
+            entry = &offblast->romMatchCache->entries[found->entryIndex];
+        }
+        else {
+            cache = reserveDbBatch(&cacheBatch, 1);
+            if (!cache) {
+                printf("couldn't grow the ROM match cache\n");
+                break;
+            }
+            offblast->romMatchCache = cache;
+            entry = &cache->entries[
+                cacheBatch.committed + cacheBatch.pending++];
+        }
+
+        int32_t indexOfEntry = batch.matches[j].indexOfEntry;
+        entry->launcherSignature = theLauncher->signature;
+        entry->pathHash = pathHashes[j];
+        entry->fileSize = fileSizes[j];
+        entry->searchHash = searchHashes[j];
+        entry->csvStamp = csvStamp;
+        entry->targetSignature = indexOfEntry > -1 
+            ? targetFile->entries[indexOfEntry].targetSignature : 0;
+        entry->matchScore = batch.matches[j].matchScore;
+    }
+
+    if (offblast->romMatchCache) {
+        commitDbBatch(&cacheBatch);
+    }
+
+    for (uint32_t j = 0; j < list->numItems; j++) {
+        free(batch.searchStrings[j]);
+    }
+
+    free(workers);
+    free(batch.searchStrings);
+    free(batch.cached);
+    free(pathHashes);
+    free(fileSizes);
+    free(searchHashes);
+    free(cacheKeys);
+    freeLaunchTargetNameIndex(batch.nameIndex);
+    pthread_mutex_destroy(&batch.mutex);
+
+    return batch.matches;
+}
+
+// Steam API game entry
+typedef struct SteamGame {
+    uint32_t appid;
+    char name[256];
+    uint32_t playtime_forever;
+    uint8_t installed;
 } SteamGame;
 
 typedef struct SteamGameList {
@@ -10182,41 +10971,245 @@ SgdbCoverList *sgdbGetCovers(uint32_t gameId) {
 	return result;
 }
 
+// Readers get an empty record for a target that doesn't have one
+const LaunchTargetCold *targetCold(LaunchTarget *target) {
+    return launchTargetCold(&offblast->launchTargetDb, target);
+}
+
+// For writers, creates the target's cold record if it's missing. NULL if 
+// the cold file couldn't grow, which appendLaunchTargetCold reports.
+LaunchTargetCold *writableTargetCold(LaunchTarget *target) {
+    return appendLaunchTargetCold(&offblast->launchTargetDb, target);
+}
+
+// Use on a freshly appended target, clears its hot record and creates its 
+// cold one
+void resetTarget(LaunchTarget *target) {
+    memset(target, 0, sizeof(LaunchTarget));
+
+    LaunchTargetCold *cold = 
+        appendLaunchTargetCold(&offblast->launchTargetDb, target);
+    if (cold) memset(cold, 0, sizeof(LaunchTargetCold));
+}
+
+// LaunchTarget strings live in the string heap, these keep the old
+// field length limits so callers can still rely on them
+char *targetId(LaunchTarget *target) {
+    return launchTargetString(&offblast->launchTargetDb, 
+            targetCold(target)->idOffset);
+}
+
+char *targetName(LaunchTarget *target) {
+    return launchTargetString(&offblast->launchTargetDb, 
+            target->nameOffset);
+}
+
+char *targetPath(LaunchTarget *target) {
+    return launchTargetString(&offblast->launchTargetDb, 
+            targetCold(target)->pathOffset);
+}
+
+char *targetCoverUrl(LaunchTarget *target) {
+    return launchTargetString(&offblast->launchTargetDb, 
+            targetCold(target)->coverUrlOffset);
+}
+
+// The string setters return 0 if the value couldn't be stored, in which 
+// case the target keeps its old one
+int setTargetId(LaunchTarget *target, const char *id) {
+    LaunchTargetCold *cold = writableTargetCold(target);
+    if (cold == NULL) return 0;
+
+    uint32_t offset = storeLaunchTargetString(
+            &offblast->launchTargetDb, cold->idOffset, 
+            id, OFFBLAST_NAME_MAX - 1);
+    if (offset == LAUNCH_TARGET_STRING_FAILED) return 0;
+
+    cold->idOffset = offset;
+    return 1;
+}
+
+int setTargetName(LaunchTarget *target, const char *name) {
+    uint32_t offset = storeLaunchTargetString(
+            &offblast->launchTargetDb, target->nameOffset, 
+            name, OFFBLAST_NAME_MAX - 1);
+    if (offset == LAUNCH_TARGET_STRING_FAILED) return 0;
+
+    target->nameOffset = offset;
+    return 1;
+}
+
+// Also keeps the hot installed flag in step with the path
+int setTargetPath(LaunchTarget *target, const char *path) {
+    LaunchTargetCold *cold = writableTargetCold(target);
+    if (cold == NULL) return 0;
+
+    uint32_t offset = storeLaunchTargetString(
+            &offblast->launchTargetDb, cold->pathOffset, 
+            path, PATH_MAX - 1);
+    if (offset == LAUNCH_TARGET_STRING_FAILED) return 0;
+
+    cold->pathOffset = offset;
+
+    if (cold->pathOffset != 0) {
+        target->flags |= LAUNCH_TARGET_INSTALLED;
+    }
+    else {
+        target->flags &= ~LAUNCH_TARGET_INSTALLED;
+    }
+
+    return 1;
+}
+
+// Platforms and owners are interned, the target only stores their ids
+char *targetPlatform(LaunchTarget *target) {
+    return launchTargetDictValue(&offblast->launchTargetDb, 
+            target->platformId);
+}
+
+char *targetOwner(LaunchTarget *target) {
+    return launchTargetDictValue(&offblast->launchTargetDb, 
+            target->ownerId);
+}
+
+void setTargetPlatform(LaunchTarget *target, const char *platform) {
+    target->platformId = launchTargetDictId(&offblast->launchTargetDb, 
+            platform);
+}
+
+void setTargetOwner(LaunchTarget *target, const char *owner) {
+    target->ownerId = launchTargetDictId(&offblast->launchTargetDb, owner);
+}
+
+// Targets whose OpenGameDB row has gone only show up while installed
+uint32_t targetRetired(LaunchTarget *target) {
+    return (target->flags & LAUNCH_TARGET_RETIRED) 
+        && !(target->flags & LAUNCH_TARGET_INSTALLED);
+}
+
+// Steam targets tagged with an owner only show up for that owner
+uint32_t targetOwnedByPlayer(LaunchTarget *target) {
+    if (target->ownerId == 0 
+            || target->platformId != offblast->steamPlatformId
+            || offblast->player.user == NULL) 
+    {
+        return 1;
+    }
+
+    return target->ownerId == offblast->playerOwnerId;
+}
+
+void setPlayerOwner(User *user) {
+    const char *steamAccount = getUserCustomField(user, "steam_account_name");
+
+    // Interned rather than looked up so a later Steam import that tags
+    // this account gets the same id
+    if (steamAccount && steamAccount[0]) {
+        offblast->playerOwnerId = launchTargetDictId(
+                &offblast->launchTargetDb, steamAccount);
+    }
+    else {
+        offblast->playerOwnerId = LAUNCH_TARGET_DICT_MISSING;
+    }
+}
+
+int setTargetCoverUrl(LaunchTarget *target, const char *coverUrl) {
+    LaunchTargetCold *cold = writableTargetCold(target);
+    if (cold == NULL) return 0;
+
+    uint32_t offset = storeLaunchTargetString(
+            &offblast->launchTargetDb, cold->coverUrlOffset, 
+            coverUrl, PATH_MAX - 1);
+    if (offset == LAUNCH_TARGET_STRING_FAILED) return 0;
+
+    cold->coverUrlOffset = offset;
+    return 1;
+}
+
+void setTargetMatchScore(LaunchTarget *target, float matchScore) {
+    LaunchTargetCold *cold = writableTargetCold(target);
+    if (cold) cold->matchScore = matchScore;
+}
+
+void setTargetDescriptionOffset(LaunchTarget *target, off_t offset) {
+    LaunchTargetCold *cold = writableTargetCold(target);
+    if (cold) cold->descriptionOffset = offset;
+}
+
+// Appends a description, compressed when the file has a dictionary, and 
+// returns its offset or -1. Without a batch it's part of the file straight 
+// away.
+off_t appendTargetDescription(LaunchTarget *target, const char *text, 
+        size_t length, OffblastDbBatch *batch) 
+{
+    OffblastDbBatch single;
+    if (batch == NULL) {
+        beginDbBatch(&single, &offblast->descriptionDb, 1, 
+                OFFBLAST_DB_TYPE_BLOB);
+    }
+
+    off_t offset = appendDescription(batch ? batch : &single, 
+            &offblast->descriptionCodec, target->targetSignature, 
+            text, length);
+
+    offblast->descriptionFile = 
+        (OffblastBlobFile*) offblast->descriptionDb.memory;
+
+    if (offset != -1 && batch == NULL) {
+        offblast->descriptionFile->cursor = single.committed + single.pending;
+    }
+
+    return offset;
+}
+
 // Write a description blob and return the offset, or 0 on failure
 off_t writeDescriptionBlob(LaunchTarget *target, const char *description) {
     if (!description || strlen(description) == 0) return 0;
 
-    size_t descLen = strlen(description);
-    size_t blobSize = sizeof(OffblastBlob) + descLen + 1;
+    off_t offset = appendTargetDescription(target, description, 
+            strlen(description), NULL);
 
-    // Grow file if necessary
-    void *pDescriptionFile = growDbFileIfNecessary(
-        &offblast->descriptionDb,
-        blobSize,
-        OFFBLAST_DB_TYPE_BLOB);
-
-    if (pDescriptionFile == NULL) {
+    if (offset == -1) {
         printf("Couldn't expand description file for Steam metadata\n");
         return 0;
     }
 
-    offblast->descriptionFile = (OffblastBlobFile*) pDescriptionFile;
+    return offset;
+}
 
-    // Write the blob at cursor position
-    OffblastBlob *newDescription = (OffblastBlob*)
-        &offblast->descriptionFile->memory[offblast->descriptionFile->cursor];
+// Unescapes a description from the CSV and appends it, returning its 
+// offset or -1. The target itself is left alone.
+off_t appendDescriptionField(LaunchTarget *target, 
+        const CsvField *description, OffblastDbBatch *batch) 
+{
+    size_t descLen = csvFieldLength(description);
+    char *text = malloc(descLen + 1);
+    if (!text) return -1;
+    csvFieldCopy(description, text);
 
-    newDescription->targetSignature = target->targetSignature;
-    newDescription->length = descLen;
-    memcpy(&newDescription->content, description, descLen);
-    *(newDescription->content + descLen) = '\0';
+    off_t offset = appendTargetDescription(target, text, descLen, batch);
+    free(text);
 
-    off_t offset = offblast->descriptionFile->cursor;
-    offblast->descriptionFile->cursor += blobSize;
+    if (offset == -1) {
+        printf("Couldn't expand description file\n");
+    }
 
     return offset;
 }
 
+// Same as writeDescriptionBlob but unescapes from the CSV, sets the 
+// target's offset and returns 0 on failure. With a batch the blob is only 
+// part of the file once the batch is committed.
+int storeDescriptionField(LaunchTarget *target, const CsvField *description,
+        OffblastDbBatch *batch) 
+{
+    off_t offset = appendDescriptionField(target, description, batch);
+    if (offset == -1) return 0;
+
+    setTargetDescriptionOffset(target, offset);
+    return 1;
+}
+
 // Check if a name indicates a non-game (tool, runtime, etc.)
 int isSteamTool(const char *name) {
     if (strstr(name, "Proton") != NULL) return 1;
@@ -10467,13 +11460,8 @@ void writeMetadataToDatabase(OffblastUi *offblast, uint64_t targetSignature,
     // CALLER MUST HOLD steamMetadataLock
 
     // Find target by signature
-    int32_t targetIndex = -1;
-    for (uint32_t i = 0; i < offblast->launchTargetFile->nEntries; i++) {
-        if (offblast->launchTargetFile->entries[i].targetSignature == targetSignature) {
-            targetIndex = i;
-            break;
-        }
-    }
+    int32_t targetIndex = launchTargetIndexLookup(
+            &offblast->launchTargetDb, targetSignature);
 
     if (targetIndex == -1) {
         printf("ERROR: Could not find target with signature %lu\n", targetSignature);
@@ -10501,9 +11489,9 @@ void writeMetadataToDatabase(OffblastUi *offblast, uint64_t targetSignature,
 
     // Write description blob
     if (meta->description) {
-        target->descriptionOffset = writeDescriptionBlob(target, meta->description);
-        if (target->descriptionOffset > 0) {
-            printf("  [Metadata] Stored description at offset %lu\n", target->descriptionOffset);
+        setTargetDescriptionOffset(target, writeDescriptionBlob(target, meta->description));
+        if (targetCold(target)->descriptionOffset > 0) {
+            printf("  [Metadata] Stored description at offset %lu\n", targetCold(target)->descriptionOffset);
         }
     } else {
         printf("  [Metadata] No description returned\n");
@@ -10513,13 +11501,8 @@ void writeMetadataToDatabase(OffblastUi *offblast, uint64_t targetSignature,
 void markMetadataFetchFailed(OffblastUi *offblast, uint64_t targetSignature) {
     // CALLER MUST HOLD steamMetadataLock
 
-    int32_t targetIndex = -1;
-    for (uint32_t i = 0; i < offblast->launchTargetFile->nEntries; i++) {
-        if (offblast->launchTargetFile->entries[i].targetSignature == targetSignature) {
-            targetIndex = i;
-            break;
-        }
-    }
+    int32_t targetIndex = launchTargetIndexLookup(
+            &offblast->launchTargetDb, targetSignature);
 
     if (targetIndex == -1) return;
 
@@ -10821,81 +11804,59 @@ void importFromDesktop(Launcher *theLauncher) {
         return;
     }
 
-    // Check if rescrape is required
-    uint32_t rescrapeRequired = 0;
-    if (launcherContentsCacheUpdated(theLauncher->signature, romListContentSig(list))) {
-        printf("Desktop launcher targets for %u have changed!\n", theLauncher->signature);
-        rescrapeRequired = 1;
-    } else {
-        printf("Contents unchanged for: %u\n", theLauncher->signature);
-    }
+    // Only files that weren't there on the last scan need matching
+    uint64_t *romHashes;
+    uint32_t nRoms;
+    RomFoundList *addedRoms = 
+        launcherContentsDiff(theLauncher, list, &romHashes, &nRoms);
+    freeRomList(list);
+    list = addedRoms;
+    uint32_t rescrapeRequired = list->numItems > 0;
 
     if (rescrapeRequired) {
-        // Match each .desktop file against OpenGameDB
+        RomMatch *matches = matchRomList(theLauncher, list);
+        if (!matches) {
+            printf("couldn't allocate .desktop matches for %u\n", 
+                    theLauncher->signature);
+            free(romHashes);
+            freeRomList(list);
+            return;
+        }
+
         for (uint32_t j = 0; j < list->numItems; j++) {
             char *gameName = list->items[j].name;
-            float matchScore = 0;
-
-            printf("\nSearching for .desktop game: %s\n", gameName);
-            printf("       Platform: %s\n", theLauncher->platform);
-            printf("       Match field: %s\n", theLauncher->matchField);
-
-            int32_t indexOfEntry = launchTargetIndexByFieldMatch(
-                    offblast->launchTargetFile,
-                    theLauncher->matchField,
-                    gameName,
-                    theLauncher->platform,
-                    &matchScore);
-
-            // Try with converted numerals if no match found
-            if ((indexOfEntry == -1 || matchScore < 1.0) && strcmp(theLauncher->matchField, "title") == 0) {
-                char *convertedName = convertNumeralInGameName(gameName);
-                if (convertedName) {
-                    printf("       Trying with converted numerals: %s\n", convertedName);
-                    float convertedMatchScore = 0;
-                    int32_t convertedIndex = launchTargetIndexByFieldMatch(
-                            offblast->launchTargetFile,
-                            theLauncher->matchField,
-                            convertedName,
-                            theLauncher->platform,
-                            &convertedMatchScore);
-
-                    if (convertedIndex > -1 && convertedMatchScore > matchScore) {
-                        indexOfEntry = convertedIndex;
-                        matchScore = convertedMatchScore;
-                    }
-                    free(convertedName);
-                }
-            }
+            int32_t indexOfEntry = matches[j].indexOfEntry;
+            float matchScore = matches[j].matchScore;
 
             if (indexOfEntry > -1 &&
-                matchScore > offblast->launchTargetFile->entries[indexOfEntry].matchScore) {
+                matchScore > targetCold(&offblast->launchTargetFile->entries[indexOfEntry])->matchScore) {
 
                 LaunchTarget *theTarget = &offblast->launchTargetFile->entries[indexOfEntry];
 
-                if (theTarget->path != NULL && strlen(theTarget->path)) {
-                    printf("%s already has a path, overwriting with .desktop file\n", theTarget->name);
-                    memset(&theTarget->path, 0x00, PATH_MAX);
+                if (strlen(targetPath(theTarget))) {
+                    printf("%s already has a path, overwriting with .desktop file\n", targetName(theTarget));
                 }
 
+                if (!setTargetPath(theTarget, list->items[j].path)) continue;
                 theTarget->launcherSignature = theLauncher->signature;
-                strncpy(theTarget->path, list->items[j].path, PATH_MAX - 1);
-                theTarget->path[PATH_MAX - 1] = '\0';
-                theTarget->matchScore = matchScore;
+                setTargetMatchScore(theTarget, matchScore);
 
                 printf("Matched .desktop '%s' to '%s' (score: %.2f)\n",
-                       gameName, theTarget->name, matchScore);
+                       gameName, targetName(theTarget), matchScore);
 
                 if (matchScore < 0.5) {
-                    logPoorMatch(list->items[j].path, theTarget->name, matchScore);
+                    logPoorMatch(list->items[j].path, targetName(theTarget), matchScore);
                 }
             } else {
                 printf("No match found for .desktop file: %s\n", gameName);
                 logMissingGame(list->items[j].path);
             }
         }
+
+        free(matches);
     }
 
+    commitLauncherManifest(theLauncher->signature, romHashes, nRoms);
     freeRomList(list);
 }
 
@@ -11363,6 +12324,28 @@ void importFromSteam(Launcher *theLauncher) {
         char *cachedSteamAccount = getCurrentSteamAccount();
         printf("[Steam Import] Caching Steam account for tagging: %s\n", cachedSteamAccount ? cachedSteamAccount : "NULL");
 
+        // New targets and play times are appended in batches, committed 
+        // before the metadata workers go looking for them
+        OffblastDbBatch targetBatch;
+        beginDbBatch(&targetBatch, &offblast->launchTargetDb.targets, 
+                sizeof(LaunchTarget), OFFBLAST_DB_TYPE_FIXED);
+        OffblastDbBatch playTimeBatch;
+        beginDbBatch(&playTimeBatch, &offblast->playTimeDb, 
+                sizeof(PlayTime), OFFBLAST_DB_TYPE_FIXED);
+
+        LaunchTargetFile *ltFile = 
+            reserveDbBatch(&targetBatch, steamGames->count);
+        PlayTimeFile *playTimeFile = 
+            reserveDbBatch(&playTimeBatch, steamGames->count);
+        if (ltFile == NULL || playTimeFile == NULL) {
+            printf("Couldn't expand the db files for the Steam library\n");
+            destroyMetadataQueue(&queue);
+            freeSteamGameList(steamGames);
+            return;
+        }
+        offblast->launchTargetFile = ltFile;
+        offblast->playTimeFile = playTimeFile;
+
         // PASS 1: Create/update targets, sync playtime, queue metadata work
         for (uint32_t i = 0; i < steamGames->count; i++) {
             SteamGame *sg = &steamGames->games[i];
@@ -11382,17 +12365,15 @@ void importFromSteam(Launcher *theLauncher) {
 
             // Check if we already have this game
             int32_t indexOfEntry = launchTargetIndexByIdMatch(
-                offblast->launchTargetFile, appIdStr, theLauncher->platform);
+                &offblast->launchTargetDb, appIdStr, theLauncher->platform);
 
             LaunchTarget *target;
 
             if (indexOfEntry >= 0) {
                 // Update existing entry
-                target = &offblast->launchTargetFile->entries[indexOfEntry];
+                target = &ltFile->entries[indexOfEntry];
             } else {
-                // Create new entry
-                LaunchTargetFile *ltFile = offblast->launchTargetFile;
-
+                // Create new entry, room was reserved for all of them
                 // Generate target signature
                 char *gameSeed;
                 asprintf(&gameSeed, "%s_%s", theLauncher->platform, appIdStr);
@@ -11400,32 +12381,34 @@ void importFromSteam(Launcher *theLauncher) {
                 lmmh_x86_128(gameSeed, strlen(gameSeed), 33, (uint32_t*)targetSignature);
                 free(gameSeed);
 
-                target = &ltFile->entries[ltFile->nEntries];
-                memset(target, 0, sizeof(LaunchTarget));
+                target = &ltFile->entries[
+                    targetBatch.committed + targetBatch.pending];
+                resetTarget(target);
                 target->targetSignature = targetSignature[0];
 
                 // Set platform
-                strncpy(target->platform, theLauncher->platform, 255);
-                target->platform[255] = '\0';
+                setTargetPlatform(target, theLauncher->platform);
 
-                // Set ID
-                strncpy(target->id, appIdStr, OFFBLAST_NAME_MAX - 1);
-                target->id[OFFBLAST_NAME_MAX - 1] = '\0';
+                // Set ID, the name is needed before it's part of the file
+                if (!setTargetId(target, appIdStr)
+                        || !setTargetName(target, sg->name))
+                {
+                    printf("Couldn't store the strings for %s\n", sg->name);
+                    continue;
+                }
 
-                ltFile->nEntries++;
+                targetBatch.pending++;
                 printf("Added new Steam game: %s (%s)\n", sg->name, appIdStr);
             }
 
             // Update name from API (always fresh)
-            strncpy(target->name, sg->name, OFFBLAST_NAME_MAX - 1);
-            target->name[OFFBLAST_NAME_MAX - 1] = '\0';
+            setTargetName(target, sg->name);
 
             // Tag with Steam account owner (use cached value)
             if (cachedSteamAccount) {
-                strncpy(target->ownerTag, cachedSteamAccount, 63);
-                target->ownerTag[63] = '\0';
+                setTargetOwner(target, cachedSteamAccount);
             } else {
-                target->ownerTag[0] = '\0';
+                target->ownerId = 0;
             }
 
             // Set cover URL
@@ -11433,8 +12416,7 @@ void importFromSteam(Launcher *theLauncher) {
             snprintf(coverUrl, PATH_MAX,
                 "https://steamcdn-a.akamaihd.net/steam/apps/%u/library_600x900.jpg",
                 sg->appid);
-            strncpy(target->coverUrl, coverUrl, PATH_MAX - 1);
-            target->coverUrl[PATH_MAX - 1] = '\0';
+            setTargetCoverUrl(target, coverUrl);
 
             // Set launcher signature based on install status
             if (sg->installed) {
@@ -11450,33 +12432,25 @@ void importFromSteam(Launcher *theLauncher) {
 
                 // Find or create PlayTime entry
                 PlayTime *pt = NULL;
-                for (uint32_t j = 0; j < offblast->playTimeFile->nEntries; ++j) {
-                    if (offblast->playTimeFile->entries[j].targetSignature == target->targetSignature) {
-                        pt = &offblast->playTimeFile->entries[j];
+                for (uint32_t j = 0; j < playTimeFile->nEntries; ++j) {
+                    if (playTimeFile->entries[j].targetSignature == target->targetSignature) {
+                        pt = &playTimeFile->entries[j];
                         break;
                     }
                 }
 
                 if (pt == NULL) {
                     // Create new entry
-                    void *growState = growDbFileIfNecessary(
-                            &offblast->playTimeDb,
-                            sizeof(PlayTime),
-                            OFFBLAST_DB_TYPE_FIXED);
-
-                    if (growState != NULL) {
-                        offblast->playTimeFile = (PlayTimeFile*) growState;
-                        pt = &offblast->playTimeFile->entries[offblast->playTimeFile->nEntries++];
-                        pt->targetSignature = target->targetSignature;
-                        pt->lastPlayed = 0;  // Steam doesn't provide this
-                    }
+                    pt = &playTimeFile->entries[
+                        playTimeBatch.committed + playTimeBatch.pending++];
+                    memset(pt, 0, sizeof(PlayTime));
+                    pt->targetSignature = target->targetSignature;
+                    pt->lastPlayed = 0;  // Steam doesn't provide this
                 }
 
-                if (pt != NULL) {
-                    // Update playtime from Steam (overwrite with Steam's authoritative data)
-                    pt->msPlayed = msPlayed;
-                    // Keep existing lastPlayed - Steam API doesn't provide this
-                }
+                // Update playtime from Steam (overwrite with Steam's authoritative data)
+                pt->msPlayed = msPlayed;
+                // Keep existing lastPlayed - Steam API doesn't provide this
             }
 
             // Queue metadata fetch if needed (use ranking as marker - it's set to score or 999)
@@ -11485,6 +12459,15 @@ void importFromSteam(Launcher *theLauncher) {
             }
         }
 
+        commitDbBatch(&playTimeBatch);
+        commitLaunchTargetBatch(&offblast->launchTargetDb, &targetBatch);
+
+        // Steam rewrites most of the play times at once, cheaper to sort 
+        // them again than to settle each one
+        if (!rebuildPlayTimeRanks(&offblast->playTimeRankDb, playTimeFile)) {
+            printf("Couldn't rebuild the play time ranks\n");
+        }
+
         // PASS 2: Fetch metadata in parallel
         if (queue.count > 0) {
             pthread_mutex_lock(&offblast->loadingState.mutex);
@@ -11530,6 +12513,11 @@ local_fallback:
         return;
     }
 
+    // New games only become visible once they've all been added
+    OffblastDbBatch targetBatch;
+    beginDbBatch(&targetBatch, &offblast->launchTargetDb.targets, 
+            sizeof(LaunchTarget), OFFBLAST_DB_TYPE_FIXED);
+
     struct dirent *entry;
     while ((entry = readdir(dir)) != NULL) {
         // Look for appmanifest_*.acf files
@@ -11579,7 +12567,7 @@ local_fallback:
 
         // Find or create entry
         int32_t indexOfEntry = launchTargetIndexByIdMatch(
-            offblast->launchTargetFile, appIdStr, theLauncher->platform);
+            &offblast->launchTargetDb, appIdStr, theLauncher->platform);
 
         if (indexOfEntry >= 0) {
             // Update existing - mark as installed
@@ -11587,7 +12575,12 @@ local_fallback:
             target->launcherSignature = theLauncher->signature;
         } else {
             // Create new entry
-            LaunchTargetFile *ltFile = offblast->launchTargetFile;
+            LaunchTargetFile *ltFile = reserveDbBatch(&targetBatch, 1);
+            if (ltFile == NULL) {
+                printf("Couldn't expand the db file for %s\n", gameName);
+                break;
+            }
+            offblast->launchTargetFile = ltFile;
 
             char *gameSeed;
             asprintf(&gameSeed, "%s_%s", theLauncher->platform, appIdStr);
@@ -11595,32 +12588,35 @@ local_fallback:
             lmmh_x86_128(gameSeed, strlen(gameSeed), 33, (uint32_t*)targetSignature);
             free(gameSeed);
 
-            LaunchTarget *target = &ltFile->entries[ltFile->nEntries];
-            memset(target, 0, sizeof(LaunchTarget));
+            LaunchTarget *target = &ltFile->entries[
+                targetBatch.committed + targetBatch.pending];
+            resetTarget(target);
 
             target->targetSignature = targetSignature[0];
-            strncpy(target->name, gameName, OFFBLAST_NAME_MAX - 1);
-            target->name[OFFBLAST_NAME_MAX - 1] = '\0';
-            strncpy(target->platform, theLauncher->platform, 255);
-            target->platform[255] = '\0';
-            strncpy(target->id, appIdStr, OFFBLAST_NAME_MAX - 1);
-            target->id[OFFBLAST_NAME_MAX - 1] = '\0';
+            setTargetPlatform(target, theLauncher->platform);
 
             char coverUrl[PATH_MAX];
             snprintf(coverUrl, PATH_MAX,
                 "https://steamcdn-a.akamaihd.net/steam/apps/%s/library_600x900.jpg",
                 appIdStr);
-            strncpy(target->coverUrl, coverUrl, PATH_MAX - 1);
-            target->coverUrl[PATH_MAX - 1] = '\0';
+
+            if (!setTargetName(target, gameName)
+                    || !setTargetId(target, appIdStr)
+                    || !setTargetCoverUrl(target, coverUrl))
+            {
+                printf("Couldn't store the strings for %s\n", gameName);
+                break;
+            }
 
             target->launcherSignature = theLauncher->signature;
-            ltFile->nEntries++;
+            targetBatch.pending++;
 
             printf("Added local Steam game: %s (%s)\n", gameName, appIdStr);
         }
     }
 
     closedir(dir);
+    commitLaunchTargetBatch(&offblast->launchTargetDb, &targetBatch);
 }
 
 // Convert arabic numeral to roman numeral (1-39)
@@ -12619,127 +13615,64 @@ void importFromCustom(Launcher *theLauncher) {
         return;
     }
 
-    uint32_t rescrapeRequired = 0;
-    if (launcherContentsCacheUpdated(theLauncher->signature, romListContentSig(list))) {
-        printf("Launcher targets for %u have changed!\n", 
-                theLauncher->signature);
-        rescrapeRequired = 1;
-    }
-    else {
-        printf("Contents unchanged for: %u\n", theLauncher->signature);
-    }
+    // Only ROMs that weren't there on the last scan need matching
+    uint64_t *romHashes;
+    uint32_t nRoms;
+    RomFoundList *addedRoms = 
+        launcherContentsDiff(theLauncher, list, &romHashes, &nRoms);
+    freeRomList(list);
+    list = addedRoms;
+    uint32_t rescrapeRequired = list->numItems > 0;
 
     if (rescrapeRequired) {
-        void *romData = calloc(1, ROM_PEEK_SIZE);
+        RomMatch *matches = matchRomList(theLauncher, list);
+        if (!matches) {
+            printf("couldn't allocate ROM matches for %u\n", 
+                    theLauncher->signature);
+            free(romHashes);
+            freeRomList(list);
+            return;
+        }
 
         for (uint32_t j=0; j< list->numItems; j++) {
 
-            char *searchString = NULL;
+            int32_t indexOfEntry = matches[j].indexOfEntry;
+            float matchScore = matches[j].matchScore;
 
-            // Check if we have a stored name (from pattern-based scanning)
-            if (list->items[j].name[0] != '\0') {
-                // Use the stored name for pattern-based scanning (Wii U, PS3, ScummVM)
-                searchString = strdup(list->items[j].name);
-                printf("Using stored name for matching: %s\n", searchString);
-            }
-            else {
-                // Fall back to extracting from filename for regular scanning
-                searchString = calloc(1,
-                        strlen((char*)&list->items[j].path) + 1);
-
-                char *startOfFileName =
-                    strrchr((char*)&list->items[j].path, '/');
-
-                startOfFileName++;
-                mempcpy(searchString,
-                        startOfFileName,
-                        strlen(startOfFileName));
-
-                char *ext = strchr(searchString, '(');
-
-                if (ext == NULL) ext = strrchr(searchString, '.');
-                if (ext != NULL) {
-                    *ext = '\0';
-                    if (ext > searchString && *(ext-1) == ' ') *(ext-1) = '\0';
-                }
-            }
-
-            float matchScore = 0;
-
-            printf("\nDEBUG: Searching for ROM: %s\n", searchString);
-            printf("       Platform: %s\n", theLauncher->platform);
-            printf("       Match field: %s\n", theLauncher->matchField);
-
-            int32_t indexOfEntry = launchTargetIndexByFieldMatch(
-                    offblast->launchTargetFile,
-                    theLauncher->matchField,
-                    searchString,
-                    theLauncher->platform,
-                    &matchScore);
-
-            // Try with converted numerals if no match found or poor match
-            if ((indexOfEntry == -1 || matchScore < 1.0) && strcmp(theLauncher->matchField, "title") == 0) {
-                char *convertedName = convertNumeralInGameName(searchString);
-                if (convertedName) {
-                    printf("       Trying with converted numerals: %s\n", convertedName);
-                    float convertedMatchScore = 0;
-                    int32_t convertedIndex = launchTargetIndexByFieldMatch(
-                            offblast->launchTargetFile,
-                            theLauncher->matchField,
-                            convertedName,
-                            theLauncher->platform,
-                            &convertedMatchScore);
-
-                    // Use converted version if it's better
-                    if (convertedIndex > -1 && convertedMatchScore > matchScore) {
-                        printf("       Converted version matched better: score %f vs %f\n",
-                               convertedMatchScore, matchScore);
-                        indexOfEntry = convertedIndex;
-                        matchScore = convertedMatchScore;
-                    }
-                    free(convertedName);
-                }
-            }
-
-            free(searchString);
-
-            if (indexOfEntry > -1) {
-                printf("DEBUG: Found match at index %d with score %f\n", indexOfEntry, matchScore);
-                LaunchTarget *theTarget = &offblast->launchTargetFile->entries[indexOfEntry];
-                printf("       Matched to: %s\n", theTarget->name);
-                printf("       Current matchScore: %f, new matchScore: %f\n",
-                       theTarget->matchScore, matchScore);
-            } else {
-                printf("DEBUG: No match found at all\n");
+            if (indexOfEntry > -1) {
+                printf("DEBUG: Found match at index %d with score %f\n", indexOfEntry, matchScore);
+                LaunchTarget *theTarget = &offblast->launchTargetFile->entries[indexOfEntry];
+                printf("       Matched to: %s\n", targetName(theTarget));
+                printf("       Current matchScore: %f, new matchScore: %f\n",
+                       targetCold(theTarget)->matchScore, matchScore);
+            } else {
+                printf("DEBUG: No match found at all\n");
             }
 
             if (indexOfEntry > -1 &&
-                    matchScore > offblast->launchTargetFile->entries[indexOfEntry].matchScore)             {
+                    matchScore > targetCold(&offblast->launchTargetFile->entries[indexOfEntry])->matchScore)             {
 
                 LaunchTarget *theTarget =
                     &offblast->launchTargetFile->entries[indexOfEntry];
 
-                if (theTarget->path != NULL && strlen(theTarget->path)) {
+                if (strlen(targetPath(theTarget))) {
                     printf("%s already has a path, overwriting with %s\n",
-                            theTarget->name,
+                            targetName(theTarget),
                             list->items[j].path);
-
-                    memset(&theTarget->path, 0x00, PATH_MAX);
                 }
 
+                if (!setTargetPath(theTarget, (char *) &list->items[j].path)) {
+                    continue;
+                }
                 theTarget->launcherSignature = theLauncher->signature;
-                strncpy(theTarget->path,
-                        (char *) &list->items[j].path,
-                        PATH_MAX - 1);
-                theTarget->path[PATH_MAX - 1] = '\0';
-                theTarget->matchScore = matchScore;
+                setTargetMatchScore(theTarget, matchScore);
 
-                printf("DEBUG: Successfully assigned path to %s\n", theTarget->name);
+                printf("DEBUG: Successfully assigned path to %s\n", targetName(theTarget));
 
                 // Log poor matches for review
                 if (matchScore < 0.5) {
                     printf("WARNING: Poor match score (%.2f) - logging for review\n", matchScore);
-                    logPoorMatch(list->items[j].path, theTarget->name, matchScore);
+                    logPoorMatch(list->items[j].path, targetName(theTarget), matchScore);
                 }
 
             }
@@ -12749,55 +13682,279 @@ void importFromCustom(Launcher *theLauncher) {
             }
         }
 
-        free(romData);
+        free(matches);
     } 
 
+    commitLauncherManifest(theLauncher->signature, romHashes, nRoms);
     freeRomList(list);
     list = NULL;
     return;
 }
 
 
-uint32_t launcherContentsCacheUpdated(uint32_t launcherSignature, uint32_t newContentsHash) {
+LauncherManifest *findLauncherManifest(uint32_t launcherSignature) {
+    LauncherContentsFile *cache = &offblast->launcherContentsCache;
+
+    for (uint32_t i = 0; i < cache->length; ++i) {
+        if (cache->entries[i].launcherSignature == launcherSignature) {
+            return &cache->entries[i];
+        }
+    }
+
+    cache->entries = realloc(cache->entries, 
+            (cache->length + 1) * sizeof(LauncherManifest));
+    assert(cache->entries);
+
+    LauncherManifest *manifest = &cache->entries[cache->length++];
+    manifest->launcherSignature = launcherSignature;
+    manifest->nRoms = 0;
+    manifest->romHashes = NULL;
+
+    return manifest;
+}
+
+void invalidateLauncherContents(uint32_t launcherSignature) {
+    LauncherManifest *manifest = findLauncherManifest(launcherSignature);
+
+    printf("Invalidating cache entry for launcher %u\n", launcherSignature);
+    free(manifest->romHashes);
+    manifest->romHashes = NULL;
+    manifest->nRoms = 0;
+}
+
+void pruneLauncherContentsCache(uint32_t *launcherSignatures, 
+        uint32_t nLauncherSignatures) 
+{
+    LauncherContentsFile *cache = &offblast->launcherContentsCache;
+    uint32_t kept = 0;
+
+    for (uint32_t i = 0; i < cache->length; ++i) {
+        uint32_t configured = 0;
+        for (uint32_t j = 0; j < nLauncherSignatures; ++j) {
+            if (cache->entries[i].launcherSignature == launcherSignatures[j]) {
+                configured = 1;
+                break;
+            }
+        }
+
+        if (configured) {
+            cache->entries[kept++] = cache->entries[i];
+        }
+        else {
+            free(cache->entries[i].romHashes);
+        }
+    }
+
+    cache->length = kept;
+}
+
+void loadLauncherContentsCache() {
+    LauncherContentsFile *cache = &offblast->launcherContentsCache;
+    cache->length = 0;
+    cache->entries = NULL;
+
+    char *path;
+    asprintf(&path, "%s/launchercontents.bin", offblast->configPath);
+    FILE *fd = fopen(path, "rb");
+    free(path);
+
+    if (fd == NULL) {
+        printf("No contents hash found, everything will rescrape.\n");
+        return;
+    }
+
+    // v1 files were a bare count followed by one whole-list hash per 
+    // launcher, those can't produce a diff so every launcher matches once
+    uint32_t header[3];
+    if (fread(header, sizeof(uint32_t), 3, fd) != 3 
+            || header[0] != LAUNCHER_CONTENTS_MAGIC 
+            || header[1] != LAUNCHER_CONTENTS_VERSION) 
+    {
+        printf("Old contents hash found, everything will rescrape.\n");
+        fclose(fd);
+        return;
+    }
+
+    cache->entries = calloc(header[2], sizeof(LauncherManifest));
+    assert(cache->entries);
+
+    for (uint32_t i = 0; i < header[2]; ++i) {
+        LauncherManifest *manifest = &cache->entries[i];
+        uint32_t manifestHeader[2];
+
+        if (fread(manifestHeader, sizeof(uint32_t), 2, fd) != 2) break;
 
-    uint32_t isInvalid = 1;
-    int32_t foundAtIndex = -1;
+        manifest->launcherSignature = manifestHeader[0];
+        manifest->nRoms = manifestHeader[1];
+        manifest->romHashes = calloc(manifest->nRoms + 1, sizeof(uint64_t));
+        assert(manifest->romHashes);
 
-    for (uint32_t i=0; i < offblast->launcherContentsCache.length; ++i) {
-        if (offblast->launcherContentsCache.entries[i].launcherSignature 
-                    == launcherSignature) 
+        if (fread(manifest->romHashes, sizeof(uint64_t), manifest->nRoms, fd) 
+                != manifest->nRoms) 
         {
-            foundAtIndex = i;
-            if (offblast->launcherContentsCache.entries[i].contentSignature
-                    == newContentsHash) isInvalid = 0;
+            free(manifest->romHashes);
             break;
         }
+
+        cache->length++;
+    }
+
+    printf("Got %u launcher manifests in the contents cache\n", 
+            cache->length);
+    fclose(fd);
+}
+
+void saveLauncherContentsCache() {
+    LauncherContentsFile *cache = &offblast->launcherContentsCache;
+
+    char *path;
+    asprintf(&path, "%s/launchercontents.bin", offblast->configPath);
+    FILE *fd = fopen(path, "wb");
+    free(path);
+
+    if (fd == NULL) {
+        printf("WARNING: Could not save launcher contents cache\n");
+        return;
+    }
+
+    uint32_t header[3] = {
+        LAUNCHER_CONTENTS_MAGIC, LAUNCHER_CONTENTS_VERSION, cache->length
+    };
+    fwrite(header, sizeof(uint32_t), 3, fd);
+
+    for (uint32_t i = 0; i < cache->length; ++i) {
+        uint32_t manifestHeader[2] = {
+            cache->entries[i].launcherSignature, cache->entries[i].nRoms
+        };
+        fwrite(manifestHeader, sizeof(uint32_t), 2, fd);
+        fwrite(cache->entries[i].romHashes, sizeof(uint64_t), 
+                cache->entries[i].nRoms, fd);
+    }
+
+    fclose(fd);
+    printf("Updated launcher contents cache\n");
+}
+
+// Covers everything the matcher sees, so a renamed pattern match or 
+// .desktop entry counts as a new ROM
+uint64_t romIdentityHash(RomFound *rom) {
+    char identity[sizeof(rom->path) + sizeof(rom->name) + sizeof(rom->id)];
+    int length = snprintf(identity, sizeof(identity), "%s\n%s\n%s", 
+            rom->path, rom->name, rom->id);
+
+    uint64_t hash[2] = {0, 0};
+    lmmh_x64_128(identity, length, 33, hash);
+    return hash[0];
+}
+
+uint64_t romPathHash(const char *path) {
+    uint64_t hash[2] = {0, 0};
+    lmmh_x64_128(path, strlen(path), 33, hash);
+    return hash[0];
+}
+
+int compareRomHashes(const void *a, const void *b) {
+    uint64_t left = *(const uint64_t*) a;
+    uint64_t right = *(const uint64_t*) b;
+    return (left > right) - (left < right);
+}
+
+// Compares a scan against the launcher's manifest from the previous one. 
+// Targets whose ROM has gone are cleared and only the ROMs that weren't 
+// seen last time come back, in scan order. The new manifest is handed 
+// back for commitLauncherManifest once the added ROMs have been matched, 
+// so a scan that fails part way looks at them again next time.
+RomFoundList *launcherContentsDiff(Launcher *theLauncher, RomFoundList *list,
+        uint64_t **newRomHashes, uint32_t *nNewRoms) 
+{
+    LauncherManifest *manifest = findLauncherManifest(theLauncher->signature);
+    RomFoundList *addedRoms = newRomList();
+
+    uint64_t *romHashes = calloc(list->numItems + 1, sizeof(uint64_t));
+    assert(romHashes);
+    for (uint32_t j = 0; j < list->numItems; j++) {
+        romHashes[j] = romIdentityHash(&list->items[j]);
+    }
+
+    for (uint32_t j = 0; j < list->numItems; j++) {
+        if (!bsearch(&romHashes[j], manifest->romHashes, manifest->nRoms, 
+                    sizeof(uint64_t), compareRomHashes)) 
+        {
+            pushToRomList(addedRoms, list->items[j].path, 
+                    list->items[j].name, list->items[j].id);
+        }
     }
 
-    if (isInvalid) {
-        if (foundAtIndex > -1) {
-            offblast->launcherContentsCache.entries[foundAtIndex].contentSignature 
-                = newContentsHash;
+    // Sorted and without repeats this becomes the new manifest
+    qsort(romHashes, list->numItems, sizeof(uint64_t), compareRomHashes);
+    uint32_t nUnique = 0;
+    for (uint32_t j = 0; j < list->numItems; j++) {
+        if (nUnique == 0 || romHashes[nUnique - 1] != romHashes[j]) {
+            romHashes[nUnique++] = romHashes[j];
         }
-        else {
-            size_t currentLength = offblast->launcherContentsCache.length;
-            offblast->launcherContentsCache.entries = realloc(
-                offblast->launcherContentsCache.entries,
-                (currentLength+1) * sizeof(LauncherContentsHash));
+    }
+
+    uint32_t nRemoved = 0;
+    for (uint32_t i = 0; i < manifest->nRoms; i++) {
+        if (!bsearch(&manifest->romHashes[i], romHashes, nUnique, 
+                    sizeof(uint64_t), compareRomHashes)) 
+        {
+            nRemoved++;
+        }
+    }
 
-            assert(offblast->launcherContentsCache.entries);
+    if (nRemoved > 0) {
+        uint64_t *pathHashes = calloc(list->numItems + 1, sizeof(uint64_t));
+        assert(pathHashes);
+        for (uint32_t j = 0; j < list->numItems; j++) {
+            pathHashes[j] = romPathHash(list->items[j].path);
+        }
+        qsort(pathHashes, list->numItems, sizeof(uint64_t), compareRomHashes);
 
-            offblast->launcherContentsCache.entries[currentLength].contentSignature 
-                = newContentsHash;
+        LaunchTargetFile *targetFile = offblast->launchTargetFile;
+        for (uint32_t i = 0; i < targetFile->nEntries; i++) {
+            LaunchTarget *target = &targetFile->entries[i];
+            if (target->launcherSignature != theLauncher->signature) continue;
 
-            offblast->launcherContentsCache.entries[currentLength].launcherSignature 
-                = launcherSignature;
+            uint64_t pathHash = romPathHash(targetPath(target));
+            if (bsearch(&pathHash, pathHashes, list->numItems, 
+                        sizeof(uint64_t), compareRomHashes)) 
+            {
+                continue;
+            }
 
-            offblast->launcherContentsCache.length++;
+            printf("  ROM gone, clearing assignment for: %s\n", 
+                    targetName(target));
+            setTargetPath(target, "");
+            target->launcherSignature = 0;
+            setTargetMatchScore(target, 0.0f);
         }
+
+        free(pathHashes);
+    }
+
+    *newRomHashes = romHashes;
+    *nNewRoms = nUnique;
+
+    if (addedRoms->numItems == 0 && nRemoved == 0) {
+        printf("Contents unchanged for: %u\n", theLauncher->signature);
+    }
+    else {
+        printf("Launcher targets for %u have changed: %u added, %u removed\n",
+                theLauncher->signature, addedRoms->numItems, nRemoved);
     }
 
-    return isInvalid;
+    return addedRoms;
+}
+
+// Takes ownership of romHashes, sorted and without repeats
+void commitLauncherManifest(uint32_t launcherSignature, uint64_t *romHashes, 
+        uint32_t nRoms) 
+{
+    LauncherManifest *manifest = findLauncherManifest(launcherSignature);
+    free(manifest->romHashes);
+    manifest->romHashes = romHashes;
+    manifest->nRoms = nRoms;
 }
 
 void logMissingGame(char *missingGamePath){
@@ -12844,7 +14001,7 @@ void calculateRowGeometry(UiRow *row) {
 
         theTile = &row->tiles[i];
         theTile->baseX = xAdvance;
-        Image *theImage = requestImageForTarget(theTile->target, 0);
+        Image *theImage = requestImageForTarget(theTile->target, 0, 0);
 
         theWidth = getWidthForScaledImage(
                 offblast->mainUi.boxHeight,
@@ -12854,28 +14011,258 @@ void calculateRowGeometry(UiRow *row) {
     }
 }
 
-void evictOldestTexture() {
+void initImageStoreIndex() {
+    ImageStoreIndex *index = offblast->imageIndex;
+    uint32_t tickNow = SDL_GetTicks();
+
+    for (uint32_t i = 0; i < IMAGE_STORE_BUCKETS; ++i) {
+        index->buckets[i] = IMAGE_SLOT_NONE;
+    }
+
+    // Every slot starts out unused, newest first
+    for (int32_t i = 0; i < IMAGE_STORE_SIZE; ++i) {
+        index->slots[i].hashNext = IMAGE_SLOT_NONE;
+        index->slots[i].newer = i > 0 ? i - 1 : IMAGE_SLOT_NONE;
+        index->slots[i].older = i < IMAGE_STORE_SIZE - 1 ? i + 1 : IMAGE_SLOT_NONE;
+        offblast->imageStore[i].lastUsedTick = tickNow;
+    }
+    index->newest = 0;
+    index->oldest = IMAGE_STORE_SIZE - 1;
+    index->nLoads = 0;
+    index->nextLoadSequence = 0;
+    index->cursorMoves = 0;
+    index->nUploads = 0;
+}
+
+// Signatures are already murmur output so the low bits are good enough
+static int32_t *imageBucket(uint64_t targetSignature) {
+    return &offblast->imageIndex->buckets[
+        targetSignature & (IMAGE_STORE_BUCKETS - 1)];
+}
+
+int32_t findImageSlot(uint64_t targetSignature) {
     // This function assumes the imageStoreLock is already held
-    uint32_t oldestTick = UINT32_MAX;
-    int32_t oldestIndex = -1;
+    if (targetSignature == 0) return IMAGE_SLOT_NONE;
 
-    for (uint32_t i = 0; i < IMAGE_STORE_SIZE; i++) {
-        if (offblast->imageStore[i].state == IMAGE_STATE_COMPLETE &&
-            offblast->imageStore[i].textureHandle != 0) {
-            if (offblast->imageStore[i].lastUsedTick < oldestTick) {
-                oldestTick = offblast->imageStore[i].lastUsedTick;
-                oldestIndex = i;
+    int32_t slot = *imageBucket(targetSignature);
+    while (slot != IMAGE_SLOT_NONE 
+            && offblast->imageStore[slot].targetSignature != targetSignature)
+    {
+        slot = offblast->imageIndex->slots[slot].hashNext;
+    }
+
+    return slot;
+}
+
+static void unhashImageSlot(int32_t slot) {
+    uint64_t targetSignature = offblast->imageStore[slot].targetSignature;
+    if (targetSignature == 0) return;
+
+    int32_t *link = imageBucket(targetSignature);
+    while (*link != IMAGE_SLOT_NONE && *link != slot) {
+        link = &offblast->imageIndex->slots[*link].hashNext;
+    }
+
+    if (*link == slot) *link = offblast->imageIndex->slots[slot].hashNext;
+    offblast->imageIndex->slots[slot].hashNext = IMAGE_SLOT_NONE;
+}
+
+static void hashImageSlot(int32_t slot) {
+    int32_t *bucket = imageBucket(offblast->imageStore[slot].targetSignature);
+    offblast->imageIndex->slots[slot].hashNext = *bucket;
+    *bucket = slot;
+}
+
+// Moves the slot to the newest end, the list stays in lastUsedTick order
+static void touchImageSlot(int32_t slot, uint32_t tickNow) {
+    ImageStoreIndex *index = offblast->imageIndex;
+    ImageSlot *theSlot = &index->slots[slot];
+
+    offblast->imageStore[slot].lastUsedTick = tickNow;
+    if (index->newest == slot) return;
+
+    index->slots[theSlot->newer].older = theSlot->older;
+    if (theSlot->older != IMAGE_SLOT_NONE) 
+        index->slots[theSlot->older].newer = theSlot->newer;
+    else 
+        index->oldest = theSlot->newer;
+
+    theSlot->newer = IMAGE_SLOT_NONE;
+    theSlot->older = index->newest;
+    index->slots[index->newest].newer = slot;
+    index->newest = slot;
+}
+
+// Drops the slot's texture and signature so the cover is loaded again 
+// next time it's asked for
+void forgetImageSlot(int32_t slot) {
+    // This function assumes the imageStoreLock is already held
+    Image *image = &offblast->imageStore[slot];
+
+    if (image->textureHandle != 0) {
+        glDeleteTextures(1, &image->textureHandle);
+        image->textureHandle = 0;
+        offblast->numLoadedTextures--;
+    }
+
+    unhashImageSlot(slot);
+    image->state = IMAGE_STATE_COLD;
+    image->targetSignature = 0;
+}
+
+void queueImageUpload(int32_t slot) {
+    // This function assumes the imageStoreLock is already held
+    ImageStoreIndex *index = offblast->imageIndex;
+    if (index->slots[slot].uploadPending) return;
+
+    index->slots[slot].uploadPending = 1;
+    index->uploads[index->nUploads++] = slot;
+}
+
+static uint64_t imageLoadKey(int32_t slot) {
+    ImageStoreIndex *index = offblast->imageIndex;
+    ImageSlot *theSlot = &index->slots[slot];
+
+    uint64_t distance = theSlot->loadDistance;
+    if (theSlot->loadCursorMove != index->cursorMoves) {
+        distance += IMAGE_LOAD_STALE;
+    }
+
+    return distance << 32 | theSlot->loadSequence;
+}
+
+static void placeImageLoad(uint32_t position, int32_t slot) {
+    offblast->imageIndex->loads[position] = slot;
+    offblast->imageIndex->slots[slot].loadPosition = position;
+}
+
+static void sinkImageLoad(uint32_t position) {
+    ImageStoreIndex *index = offblast->imageIndex;
+    int32_t slot = index->loads[position];
+    uint64_t key = imageLoadKey(slot);
+
+    while (1) {
+        uint32_t child = position * 2 + 1;
+        if (child >= index->nLoads) break;
+        if (child + 1 < index->nLoads 
+                && imageLoadKey(index->loads[child + 1]) 
+                    < imageLoadKey(index->loads[child])) 
+        {
+            child++;
+        }
+        if (imageLoadKey(index->loads[child]) >= key) break;
+        placeImageLoad(position, index->loads[child]);
+        position = child;
+    }
+
+    placeImageLoad(position, slot);
+}
+
+static void siftImageLoad(uint32_t position) {
+    ImageStoreIndex *index = offblast->imageIndex;
+    int32_t slot = index->loads[position];
+    uint64_t key = imageLoadKey(slot);
+
+    while (position > 0) {
+        uint32_t parent = (position - 1) / 2;
+        if (imageLoadKey(index->loads[parent]) <= key) break;
+        placeImageLoad(position, index->loads[parent]);
+        position = parent;
+    }
+
+    placeImageLoad(position, slot);
+    sinkImageLoad(position);
+}
+
+// Queues the slot, or moves it if its distance has changed
+void queueImageLoad(int32_t slot) {
+    // This function assumes the imageStoreLock is already held
+    ImageStoreIndex *index = offblast->imageIndex;
+
+    if (!index->slots[slot].loadPending) {
+        index->slots[slot].loadPending = 1;
+        index->slots[slot].loadSequence = index->nextLoadSequence++;
+        placeImageLoad(index->nLoads++, slot);
+        pthread_cond_signal(&offblast->imageLoadQueued);
+    }
+
+    siftImageLoad(index->slots[slot].loadPosition);
+}
+
+// Waits for the nearest slot that's still queued. Slots forgotten or 
+// reused since they were queued are dropped here rather than searched for.
+int32_t takeImageLoad() {
+    // This function assumes the imageStoreLock is already held
+    ImageStoreIndex *index = offblast->imageIndex;
+
+    while (1) {
+        while (index->nLoads == 0) {
+            pthread_cond_wait(&offblast->imageLoadQueued, 
+                    &offblast->imageStoreLock);
+        }
+
+        int32_t slot = index->loads[0];
+        index->slots[slot].loadPending = 0;
+        if (--index->nLoads > 0) {
+            placeImageLoad(0, index->loads[index->nLoads]);
+            sinkImageLoad(0);
+        }
+
+        if (offblast->imageStore[slot].targetSignature > 0
+                && offblast->imageStore[slot].state == IMAGE_STATE_QUEUED) 
+        {
+            return slot;
+        }
+    }
+}
+
+// Everything queued becomes stale until it's asked for again, and what 
+// hasn't been asked for in a while is cancelled
+void moveImageLoadCursor() {
+    // This function assumes the imageStoreLock is already held
+    ImageStoreIndex *index = offblast->imageIndex;
+    index->cursorMoves++;
+
+    uint32_t nKept = 0;
+    for (uint32_t i = 0; i < index->nLoads; ++i) {
+        int32_t slot = index->loads[i];
+
+        if (index->cursorMoves - index->slots[slot].loadCursorMove 
+                > IMAGE_LOAD_CANCEL_MOVES) 
+        {
+            index->slots[slot].loadPending = 0;
+            if (offblast->imageStore[slot].state == IMAGE_STATE_QUEUED) {
+                offblast->imageStore[slot].state = IMAGE_STATE_COLD;
             }
+            continue;
         }
+
+        placeImageLoad(nKept++, slot);
     }
+    index->nLoads = nKept;
 
-    if (oldestIndex != -1) {
-        // Free the texture
-        glDeleteTextures(1, &offblast->imageStore[oldestIndex].textureHandle);
-        offblast->imageStore[oldestIndex].textureHandle = 0;
-        offblast->imageStore[oldestIndex].state = IMAGE_STATE_COLD;
-        offblast->numLoadedTextures--;
+    // Keys only changed by being made stale, but not all of them were 
+    // fresh, so the heap is rebuilt rather than patched
+    for (uint32_t i = index->nLoads / 2; i-- > 0;) {
+        sinkImageLoad(i);
+    }
+}
 
+void evictOldestTexture() {
+    // This function assumes the imageStoreLock is already held
+    for (int32_t i = offblast->imageIndex->oldest; 
+            i != IMAGE_SLOT_NONE; 
+            i = offblast->imageIndex->slots[i].newer) 
+    {
+        if (offblast->imageStore[i].state == IMAGE_STATE_COMPLETE &&
+            offblast->imageStore[i].textureHandle != 0) {
+            // Free the texture
+            glDeleteTextures(1, &offblast->imageStore[i].textureHandle);
+            offblast->imageStore[i].textureHandle = 0;
+            offblast->imageStore[i].state = IMAGE_STATE_COLD;
+            offblast->numLoadedTextures--;
+            break;
+        }
     }
 }
 
@@ -12884,174 +14271,308 @@ void evictTexturesOlderThan(uint32_t ageMs) {
     uint32_t currentTick = SDL_GetTicks();
     uint32_t evictedCount = 0;
 
-    for (uint32_t i = 0; i < IMAGE_STORE_SIZE; i++) {
+    // Oldest first, so stop at the first one that's recent enough
+    for (int32_t i = offblast->imageIndex->oldest; 
+            i != IMAGE_SLOT_NONE 
+            && currentTick - offblast->imageStore[i].lastUsedTick > ageMs; 
+            i = offblast->imageIndex->slots[i].newer) 
+    {
         if (offblast->imageStore[i].state == IMAGE_STATE_COMPLETE &&
             offblast->imageStore[i].textureHandle != 0) {
-            if (currentTick - offblast->imageStore[i].lastUsedTick > ageMs) {
-                // Free the texture
-                glDeleteTextures(1, &offblast->imageStore[i].textureHandle);
-                offblast->imageStore[i].textureHandle = 0;
-                offblast->imageStore[i].state = IMAGE_STATE_COLD;
-                offblast->numLoadedTextures--;
-                evictedCount++;
-            }
+            // Free the texture
+            glDeleteTextures(1, &offblast->imageStore[i].textureHandle);
+            offblast->imageStore[i].textureHandle = 0;
+            offblast->imageStore[i].state = IMAGE_STATE_COLD;
+            offblast->numLoadedTextures--;
+            evictedCount++;
         }
     }
 
 }
 
-Image *requestImageForTarget(LaunchTarget *target, uint32_t affectQueue) {
+// Turns whatever the loaders have finished into textures, main thread only
+static void uploadReadyImages() {
+    // This function assumes the imageStoreLock is already held
+    ImageStoreIndex *index = offblast->imageIndex;
 
-    uint64_t targetSignature = target->targetSignature;
-    char *path;
-    char *url;
+    for (uint32_t u = 0; u < index->nUploads; ++u) {
+        int32_t i = index->uploads[u];
+        index->slots[i].uploadPending = 0;
+
+        // Forgotten or refreshed since it was loaded
+        if (offblast->imageStore[i].state != IMAGE_STATE_READY) continue;
+
+        if (offblast->imageStore[i].textureHandle != 0) {
+            glDeleteTextures(1, &offblast->imageStore[i].textureHandle);
+            offblast->imageStore[i].textureHandle = 0;
+            offblast->numLoadedTextures--;
+        }
 
-    int32_t foundAtIndex = -1;
-    int32_t oldestFreeIndex = -1;
-    uint32_t oldestFreeTick = 0;
+        // Check if we're at the texture limit
+        if (offblast->numLoadedTextures >= MAX_LOADED_TEXTURES) {
+            evictOldestTexture();
+        }
+
+        glGenTextures(1, &offblast->imageStore[i].textureHandle);
+        imageToGlTexture(
+                &offblast->imageStore[i].textureHandle,
+                offblast->imageStore[i].atlas,
+                offblast->imageStore[i].width,
+                offblast->imageStore[i].height);
+
+        offblast->imageStore[i].state = IMAGE_STATE_COMPLETE;
+        offblast->numLoadedTextures++;
+        free(offblast->imageStore[i].atlas);
+        offblast->imageStore[i].atlas = NULL;
+        offblast->mainUi.rowGeometryInvalid = 1;
+    }
+
+    index->nUploads = 0;
+}
 
-    // DEBUG
-    uint32_t availableSlots = 0;
-    uint32_t inLoading = 0;
-    uint32_t inDownloading = 0;
-    uint32_t inReady = 0;
-    uint32_t inQueued = 0;
+// The least recently used slot that isn't in the middle of loading
+static int32_t oldestFreeImageSlot() {
+    for (int32_t i = offblast->imageIndex->oldest; 
+            i != IMAGE_SLOT_NONE; 
+            i = offblast->imageIndex->slots[i].newer) 
+    {
+        uint8_t state = offblast->imageStore[i].state;
+        if (state == IMAGE_STATE_COLD
+                || state == IMAGE_STATE_DEAD
+                || state == IMAGE_STATE_COMPLETE)
+        {
+            return i;
+        }
+    }
 
+    return IMAGE_SLOT_NONE;
+}
+
+static void queueImageSlot(int32_t slot, LaunchTarget *target, 
+        uint32_t tickNow, uint32_t distance) 
+{
+    char *path = getCoverPath(target);
+    char *url = getCoverUrl(target);
+
+    offblast->imageStore[slot].state = IMAGE_STATE_QUEUED;
+    strncpy(offblast->imageStore[slot].path, path, PATH_MAX);
+    strncpy(offblast->imageStore[slot].url, url, PATH_MAX);
+    touchImageSlot(slot, tickNow);
+    offblast->imageIndex->slots[slot].loadDistance = distance;
+    offblast->imageIndex->slots[slot].loadCursorMove = 
+        offblast->imageIndex->cursorMoves;
+    queueImageLoad(slot);
+
+    free(path);
+    free(url);
+}
+
+// distance is how many rows plus tiles the target is from the cursor, 
+// nearer covers are loaded first
+Image *requestImageForTarget(LaunchTarget *target, uint32_t affectQueue, 
+        uint32_t distance) 
+{
+
+    uint64_t targetSignature = target->targetSignature;
     uint32_t tickNow = SDL_GetTicks();
 
-    Image *returnImage;
+    Image *returnImage = &offblast->missingCoverImage;
 
     pthread_mutex_lock(&offblast->imageStoreLock);
 
-    for (uint32_t i=0; i < IMAGE_STORE_SIZE; ++i) {
+    // Load anything that's ready.
+    uploadReadyImages();
 
-        // Load anything that's ready.
-        if (offblast->imageStore[i].state == IMAGE_STATE_READY) {
+    int32_t slot = findImageSlot(targetSignature);
 
-            // Check if we're at the texture limit
-            if (offblast->numLoadedTextures >= MAX_LOADED_TEXTURES) {
-                evictOldestTexture();
-            }
+    if (slot != IMAGE_SLOT_NONE) {
 
-            glGenTextures(1, &offblast->imageStore[i].textureHandle);
-            imageToGlTexture(
-                    &offblast->imageStore[i].textureHandle,
-                    offblast->imageStore[i].atlas,
-                    offblast->imageStore[i].width,
-                    offblast->imageStore[i].height);
+        if (affectQueue) touchImageSlot(slot, tickNow);
 
-            offblast->imageStore[i].state = IMAGE_STATE_COMPLETE;
-            offblast->numLoadedTextures++;
-            free(offblast->imageStore[i].atlas);
-            offblast->imageStore[i].atlas = NULL;
-            offblast->mainUi.rowGeometryInvalid = 1;
+        if (offblast->imageStore[slot].state == IMAGE_STATE_COMPLETE) {
+            returnImage = &offblast->imageStore[slot];
         }
-
-        // Search for the target
-        if (offblast->imageStore[i].targetSignature == targetSignature)
-        {
-            if (affectQueue) 
-                offblast->imageStore[i].lastUsedTick = tickNow;
-
-            foundAtIndex = i;
+        else if (offblast->imageStore[slot].state == IMAGE_STATE_COLD && affectQueue) {
+            // Re-queue evicted texture for loading
+            queueImageSlot(slot, target, tickNow, distance);
         }
-        else {
-            uint32_t isAvailable = 
-                    offblast->imageStore[i].state == IMAGE_STATE_COLD
-                    || offblast->imageStore[i].state == IMAGE_STATE_DEAD
-                    || offblast->imageStore[i].state == IMAGE_STATE_COMPLETE;
-
-            // DEBUG
-            if (offblast->imageStore[i].state == IMAGE_STATE_LOADING) {
-                inLoading++;
-            }
-            if (offblast->imageStore[i].state == IMAGE_STATE_READY) {
-                inReady++;
-            }
-            if (offblast->imageStore[i].state == IMAGE_STATE_QUEUED) {
-                inQueued++;
-            }
-            if (offblast->imageStore[i].state == IMAGE_STATE_DOWNLOADING) {
-                inDownloading++;
+        else if (offblast->imageStore[slot].state == IMAGE_STATE_QUEUED 
+                && affectQueue) 
+        {
+            // Still waiting, move it to where it's drawn now. The same 
+            // cover can be drawn in more than one row.
+            ImageSlot *theSlot = &offblast->imageIndex->slots[slot];
+            if (theSlot->loadCursorMove != offblast->imageIndex->cursorMoves
+                    || distance < theSlot->loadDistance)
+            {
+                theSlot->loadDistance = distance;
+                theSlot->loadCursorMove = offblast->imageIndex->cursorMoves;
+                queueImageLoad(slot);
             }
+        }
+        // TODO consider a loading image if the state is different
 
-            if (isAvailable) {
-                availableSlots++;
+    }
+    else if (affectQueue) {
 
-                //printf("slot %d available\n", i);
+        slot = oldestFreeImageSlot();
 
-                if (oldestFreeTick == 0 
-                    || offblast->imageStore[i].lastUsedTick <= oldestFreeTick) 
-                {
-                    if (affectQueue)
-                        oldestFreeTick = offblast->imageStore[i].lastUsedTick;
-                    oldestFreeIndex = i;
-                }
+        if (slot != IMAGE_SLOT_NONE) {
 
+            if (offblast->imageStore[slot].textureHandle) {
+                glDeleteTextures(1,
+                        &offblast->imageStore[slot].textureHandle);
+                offblast->numLoadedTextures--;
             }
-            else {
-                //printf("slot %d loading\n", i);
-            }
+            offblast->imageStore[slot].textureHandle = 0;
+
+            unhashImageSlot(slot);
+            offblast->imageStore[slot].targetSignature = targetSignature;
+            hashImageSlot(slot);
+
+            queueImageSlot(slot, target, tickNow, distance);
+            //printf("%"PRIu64" queued in slot %d\n", targetSignature, slot);
         }
     }
 
-    // § DEBUG - Dump out the queue status
-    //printf("\t%d av\t%d lo\t%d rd\t%d Q\t%d dl\n", availableSlots, inLoading, inReady, inQueued, inDownloading);
+    pthread_mutex_unlock(&offblast->imageStoreLock);
 
-    if (foundAtIndex > -1) {
 
+    return returnImage;
+}
 
+// Queues a cover the cursor is heading towards. Returns 1 if that's new 
+// work for the loaders, 0 if the cover was already queued or loaded.
+static uint32_t prefetchCover(LaunchTarget *target, uint32_t distance) {
 
-        if (offblast->imageStore[foundAtIndex].state == IMAGE_STATE_COMPLETE) {
-            returnImage = &offblast->imageStore[foundAtIndex];
-        }
-        else if (offblast->imageStore[foundAtIndex].state == IMAGE_STATE_COLD && affectQueue) {
-            // Re-queue evicted texture for loading
-            path = getCoverPath(target);
-            url = getCoverUrl(target);
+    pthread_mutex_lock(&offblast->imageStoreLock);
+    int32_t slot = findImageSlot(target->targetSignature);
+    uint32_t state = slot == IMAGE_SLOT_NONE 
+        ? IMAGE_STATE_COLD : offblast->imageStore[slot].state;
+    pthread_mutex_unlock(&offblast->imageStoreLock);
 
-            offblast->imageStore[foundAtIndex].state = IMAGE_STATE_QUEUED;
-            offblast->imageStore[foundAtIndex].lastUsedTick = tickNow;
-            strncpy(offblast->imageStore[foundAtIndex].path, path, PATH_MAX);
-            strncpy(offblast->imageStore[foundAtIndex].url, url, PATH_MAX);
+    if (state != IMAGE_STATE_COLD && state != IMAGE_STATE_QUEUED) return 0;
 
-            returnImage = &offblast->missingCoverImage;
-        }
-        else {
-            // TODO consider a loading image if the state is different
-            returnImage = &offblast->missingCoverImage;
-        }
+    requestImageForTarget(target, 1, distance);
+
+    return state == IMAGE_STATE_COLD;
+}
+
+// Whether the grid draws theTile while cursorTile is selected, the same 
+// span as the render loop: a tile back and on to 1.3 screens
+static uint32_t tileDrawnFrom(UiTile *cursorTile, UiTile *theTile) {
+    if (theTile == cursorTile->previous) return 1;
+
+    return theTile->baseX >= cursorTile->baseX 
+        && theTile->baseX - cursorTile->baseX < offblast->winWidth * 1.3;
+}
+
+// With tileStep 0 prefetches what's drawn around cursorTile, otherwise the 
+// lookahead tiles past the edge of the screen in that direction. Returns 
+// what's left of the budget.
+static uint32_t prefetchRowCovers(UiTile *cursorTile, int32_t tileStep, 
+        uint32_t rowDistance, uint32_t lookahead, uint32_t budget) 
+{
+    UiTile *theTile = cursorTile;
+    int32_t tileOffset = 0;
 
+    if (tileStep == 0 && theTile->previous) {
+        theTile = theTile->previous;
+        tileOffset = -1;
     }
-    else {
 
-        if (oldestFreeIndex != -1 && affectQueue) {
+    uint32_t ahead = 0;
+    while (theTile && budget > 0) {
 
-            path = getCoverPath(target);
-            url = getCoverUrl(target);
+        uint32_t drawn = tileDrawnFrom(cursorTile, theTile);
+        uint32_t distance = rowDistance + abs(tileOffset);
 
-            offblast->imageStore[oldestFreeIndex].state = IMAGE_STATE_QUEUED;
-            offblast->imageStore[oldestFreeIndex].targetSignature = targetSignature;
-            offblast->imageStore[oldestFreeIndex].lastUsedTick = tickNow;
-            strncpy(offblast->imageStore[oldestFreeIndex].path, path, PATH_MAX);
-            strncpy(offblast->imageStore[oldestFreeIndex].url, url, PATH_MAX);
+        if (tileStep == 0) {
+            if (!drawn) break;
+            budget -= prefetchCover(theTile->target, distance);
+        }
+        else if (!drawn) {
+            if (ahead++ == lookahead) break;
+            budget -= prefetchCover(theTile->target, distance);
+        }
 
-            if (offblast->imageStore[oldestFreeIndex].textureHandle) {
-                glDeleteTextures(1,
-                        &offblast->imageStore[oldestFreeIndex].textureHandle);
-                offblast->numLoadedTextures--;
-            }
-            offblast->imageStore[oldestFreeIndex].textureHandle = 0;
-            //printf("%"PRIu64" queued in slot %d\n", targetSignature, oldestFreeIndex);
+        if (tileStep < 0) {
+            theTile = theTile->previous;
+            tileOffset--;
         }
+        else {
+            theTile = theTile->next;
+            tileOffset++;
+        }
+    }
 
-        returnImage = &offblast->missingCoverImage;
+    return budget;
+}
+
+// Called as the cursor starts moving to toTile in toRow, so the covers that 
+// will scroll into view are decoding before they're drawn. rowStep is 1 
+// towards nextRow, tileStep 1 towards next. Holding a direction looks 
+// further ahead. Only tops the load queue up to coverPrefetchMaxQueued and 
+// stops short of coverPrefetchMaxTextures, so it can't evict what's 
+// on screen or starve the visible covers.
+void prefetchCovers(UiRow *toRow, UiTile *toTile, int32_t rowStep, 
+        int32_t tileStep) 
+{
+    static uint32_t lastTick = 0;
+    static int32_t lastRowStep = 0;
+    static int32_t lastTileStep = 0;
+    static uint32_t streak = 0;
+
+    MainUi *ui = &offblast->mainUi;
+    uint32_t tickNow = SDL_GetTicks();
+
+    if (rowStep == lastRowStep && tileStep == lastTileStep 
+            && tickNow - lastTick < 2 * NAVIGATION_MOVE_DURATION) 
+    {
+        if (streak < COVER_PREFETCH_MAX_STREAK) streak++;
+    }
+    else {
+        streak = 0;
     }
+    lastTick = tickNow;
+    lastRowStep = rowStep;
+    lastTileStep = tileStep;
 
+    pthread_mutex_lock(&offblast->imageStoreLock);
+    int32_t queuedRoom = (int32_t) offblast->coverPrefetchMaxQueued 
+        - offblast->imageIndex->nLoads;
+    int32_t textureRoom = (int32_t) offblast->coverPrefetchMaxTextures 
+        - offblast->numLoadedTextures - offblast->imageIndex->nLoads;
     pthread_mutex_unlock(&offblast->imageStoreLock);
 
+    int32_t room = queuedRoom < textureRoom ? queuedRoom : textureRoom;
+    if (room <= 0) return;
+    uint32_t budget = room;
 
-    return returnImage;
+    if (rowStep == 0) {
+        prefetchRowCovers(toTile, tileStep, 0, 
+                offblast->coverPrefetchTiles << streak, budget);
+        return;
+    }
+
+    // The grid draws two rows below the cursor and as many above as fit, 
+    // the rows past those are the ones about to scroll in
+    uint32_t rowsDrawn = (offblast->winHeight - offblast->winFold 
+            + 4 * ui->boxHeight + 2 * ui->boxPad) 
+        / (ui->boxHeight + ui->boxPad) + 1;
+    uint32_t rowsDrawnAhead = rowStep > 0 ? 2 : rowsDrawn - 3;
+
+    UiRow *theRow = toRow;
+    for (uint32_t i = 1; 
+            i <= rowsDrawnAhead + 1 + streak && i < ui->activeRowset->numRows 
+            && budget > 0; 
+            ++i) 
+    {
+        theRow = rowStep > 0 ? theRow->nextRow : theRow->previousRow;
+        if (i <= rowsDrawnAhead) continue;
+
+        budget = prefetchRowCovers(theRow->tileCursor, 0, i, 0, budget);
+    }
 }
 
 void condPrintConfigError(void *object, const char *message) {
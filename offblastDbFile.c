@@ -9,12 +9,60 @@
 #include <sys/types.h>
 #include <unistd.h>
 #include <string.h>
+#include <ctype.h>
+#include <pthread.h>
+#include <limits.h>
+#include <math.h>
+#include <murmurhash.h>
+#include <zlib.h>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#endif
 
 #include "offblast.h"
 #include "offblastDbFile.h"
 
 #define ITEM_BUFFER_NUM 1000ul
 #define BLOB_GROW_SIZE 1048576
+#define LAUNCH_TARGET_INDEX_MIN_SLOTS 4096ul
+
+// Address space set aside for each db file when it's opened. The file 
+// grows in place inside it, so pointers into it stay valid until it's 
+// closed. Reserving it costs no memory.
+#define DB_FILE_RESERVE_BYTES (1ull << 36)
+
+static size_t pageAlignDown(size_t n)
+{
+    size_t pageSize = sysconf(_SC_PAGESIZE);
+    return n - n % pageSize;
+}
+
+static size_t pageAlignUp(size_t n)
+{
+    size_t pageSize = sysconf(_SC_PAGESIZE);
+    return pageAlignDown(n + pageSize - 1);
+}
+
+static void *mapDbFileReserved(int fd, size_t size, size_t *nBytesReserved)
+{
+    *nBytesReserved = 0;
+    if (sizeof(void*) < 8 || size > DB_FILE_RESERVE_BYTES) return MAP_FAILED;
+
+    void *base = mmap(NULL, DB_FILE_RESERVE_BYTES, PROT_NONE, 
+            MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE, -1, 0);
+    if (base == MAP_FAILED) return MAP_FAILED;
+
+    void *memory = mmap(base, size, PROT_READ | PROT_WRITE, 
+            MAP_SHARED | MAP_FIXED, fd, 0);
+    if (memory == MAP_FAILED) {
+        munmap(base, DB_FILE_RESERVE_BYTES);
+        return MAP_FAILED;
+    }
+
+    *nBytesReserved = DB_FILE_RESERVE_BYTES;
+    return memory;
+}
 
 int InitDbFile(char *path, OffblastDbFile *dbFileStruct, 
         size_t itemSize) 
@@ -48,13 +96,20 @@ int InitDbFile(char *path, OffblastDbFile *dbFileStruct,
 
     printf("allocating %lu for %s\n", sb.st_size, path);
     dbFileStruct->fd = fd;
-    void *memory = mmap(
-            NULL, 
-            sb.st_size,
-            PROT_READ | PROT_WRITE,
-            MAP_SHARED,
-            fd,
-            0);
+    void *memory = mapDbFileReserved(fd, sb.st_size, 
+            &dbFileStruct->nBytesReserved);
+
+    // Without the reservation growing the file may move it
+    if (memory == MAP_FAILED) {
+        printf("couldn't reserve address space for %s\n", path);
+        memory = mmap(
+                NULL, 
+                sb.st_size,
+                PROT_READ | PROT_WRITE,
+                MAP_SHARED,
+                fd,
+                0);
+    }
 
     if (memory == MAP_FAILED) {
         perror("couldn't map memory for file\n");
@@ -67,80 +122,215 @@ int InitDbFile(char *path, OffblastDbFile *dbFileStruct,
     return 1;
 }
 
-
-void* growDbFileIfNecessary(OffblastDbFile* dbFileStruct, size_t itemSize, enum OffBlastDbType type) 
+// For reports. Nothing is created, grown or written, and a file too short 
+// for its header is refused rather than read past the end of.
+int openDbFileReadOnly(char *path, OffblastDbFile *dbFileStruct, 
+        size_t headerBytes)
 {
+    *dbFileStruct = (OffblastDbFile){0};
+
+    int fd = open(path, O_RDONLY);
+    if (fd == -1) return 0;
 
-    uint32_t willOverflow = 0;
-    size_t newSize = 0;
+    struct stat sb;
+    if (fstat(fd, &sb) == -1 || sb.st_size == 0 
+            || (size_t) sb.st_size < headerBytes) 
+    {
+        printf("%s is too short to hold its header\n", path);
+        close(fd);
+        return 0;
+    }
 
-    if (type == OFFBLAST_DB_TYPE_FIXED) {
+    void *memory = mmap(NULL, sb.st_size, PROT_READ, MAP_SHARED, fd, 0);
+    if (memory == MAP_FAILED) {
+        perror("couldn't map memory for file\n");
+        close(fd);
+        return 0;
+    }
 
-        OffblastDbFileFormat *dbFileActual = 
-            (OffblastDbFileFormat*)dbFileStruct->memory;
+    dbFileStruct->fd = fd;
+    dbFileStruct->memory = memory;
+    dbFileStruct->nBytesAllocated = sb.st_size;
 
-        willOverflow = dbFileActual->nEntries * itemSize + itemSize >= 
-            dbFileStruct->nBytesAllocated;
-        
-        newSize = dbFileStruct->nBytesAllocated + 
-            itemSize * (size_t) ITEM_BUFFER_NUM;
+    return 1;
+}
 
-    }
-    else if(type == OFFBLAST_DB_TYPE_BLOB) {
+void closeDbFile(OffblastDbFile *dbFileStruct)
+{
+    munmap(dbFileStruct->memory, dbFileStruct->nBytesReserved 
+            ? dbFileStruct->nBytesReserved : dbFileStruct->nBytesAllocated);
+    close(dbFileStruct->fd);
+    dbFileStruct->memory = NULL;
+    dbFileStruct->nBytesAllocated = 0;
+    dbFileStruct->nBytesReserved = 0;
+}
 
-        OffblastBlobFile *dbFileActual = 
-            (OffblastBlobFile*)dbFileStruct->memory;
+// Inside the reservation the file's pages are mapped over the reserved 
+// ones, or handed back to it when shrinking, and nothing already mapped 
+// moves
+static int resizeReservedDbFile(OffblastDbFile *dbFileStruct, size_t newSize)
+{
+    char *base = (char*) dbFileStruct->memory;
+    size_t oldSize = dbFileStruct->nBytesAllocated;
 
-        willOverflow = ((size_t)dbFileActual->cursor) + itemSize >= 
-            dbFileStruct->nBytesAllocated;
+    if (newSize > oldSize) {
+        size_t from = pageAlignDown(oldSize);
+        void *memory = mmap(base + from, newSize - from, 
+                PROT_READ | PROT_WRITE, MAP_SHARED | MAP_FIXED, 
+                dbFileStruct->fd, from);
 
-        newSize = dbFileStruct->nBytesAllocated + 
-            BLOB_GROW_SIZE;
+        if (memory == MAP_FAILED) {
+            perror("couldn't map the grown db file\n");
+            return 0;
+        }
     }
     else {
-        printf("wtf kind of db file are you using then?\n");
-        return NULL;
+        size_t keep = pageAlignUp(newSize);
+        size_t mapped = pageAlignUp(oldSize);
+
+        if (mapped > keep && mmap(base + keep, mapped - keep, PROT_NONE, 
+                    MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE | MAP_FIXED, 
+                    -1, 0) == MAP_FAILED) 
+        {
+            perror("couldn't unmap the shrunk db file\n");
+            return 0;
+        }
     }
 
+    dbFileStruct->nBytesAllocated = newSize;
+    return 1;
+}
 
-    if (willOverflow) 
+static int resizeDbFile(OffblastDbFile *dbFileStruct, size_t newSize)
+{
+    if (dbFileStruct->nBytesReserved 
+            && newSize > dbFileStruct->nBytesReserved) 
     {
+        printf("db file has outgrown its reserved address space\n");
+        return 0;
+    }
 
-        printf("DB FILE FULL, GROWING!\n");
+    if (ftruncate(dbFileStruct->fd, newSize) == -1) {
+        perror("couldn't resize db file\n");
+        return 0;
+    }
 
-        if(ftruncate(dbFileStruct->fd, newSize) == -1) {
-            return NULL;
-        }
-        else {
+    if (dbFileStruct->nBytesReserved) {
+        return resizeReservedDbFile(dbFileStruct, newSize);
+    }
 
-            struct stat sb;
+    void *memory = mremap(
+            dbFileStruct->memory,
+            dbFileStruct->nBytesAllocated,
+            newSize,
+            MREMAP_MAYMOVE);
 
-            if (fstat(dbFileStruct->fd, &sb) == -1) {
-                perror("could not open db file\n");
-                return NULL;
-            }
+    if (memory == MAP_FAILED) {
+        perror("couldn't re-map memory for file\n");
+        return 0;
+    }
 
-            printf("truncated block size %lu!\n", sb.st_size);
-            printf("newSize we were using %lu!\n", newSize);
+    dbFileStruct->memory = memory;
+    dbFileStruct->nBytesAllocated = newSize;
 
-            void *memory = mremap(
-                    dbFileStruct->memory,
-                    dbFileStruct->nBytesAllocated,
-                    sb.st_size,
-                    MREMAP_MAYMOVE
-                    );
+    return 1;
+}
 
-            if (memory == MAP_FAILED) {
-                perror("couldn't re-map memory for file\n");
-                return NULL;
-            }
+// Makes room for required bytes, doubling the file so that a run of 
+// appends only remaps a handful of times
+static int reserveDbFileBytes(OffblastDbFile *dbFileStruct, size_t required, 
+        size_t minimumGrowth)
+{
+    if (required < dbFileStruct->nBytesAllocated) return 1;
 
-            dbFileStruct->memory = memory;
-            dbFileStruct->nBytesAllocated = newSize;
-        }
+    size_t newSize = dbFileStruct->nBytesAllocated * 2;
+    if (newSize < dbFileStruct->nBytesAllocated + minimumGrowth) {
+        newSize = dbFileStruct->nBytesAllocated + minimumGrowth;
+    }
+    if (newSize <= required) newSize = required + minimumGrowth;
+
+    return resizeDbFile(dbFileStruct, newSize);
+}
+
+void* growDbFileIfNecessary(OffblastDbFile* dbFileStruct, size_t itemSize, enum OffBlastDbType type) 
+{
+    OffblastDbBatch batch;
+    beginDbBatch(&batch, dbFileStruct, itemSize, type);
+
+    // Blob batches count bytes, so a blob item is itemSize of them
+    return reserveDbBatch(&batch, 
+            type == OFFBLAST_DB_TYPE_BLOB ? itemSize : 1);
+}
+
+void beginDbBatch(OffblastDbBatch *batch, OffblastDbFile *dbFileStruct, 
+        size_t itemSize, enum OffBlastDbType type) 
+{
+    batch->file = dbFileStruct;
+    batch->type = type;
+    batch->itemSize = type == OFFBLAST_DB_TYPE_BLOB ? 1 : itemSize;
+    batch->pending = 0;
+
+    if (type == OFFBLAST_DB_TYPE_BLOB) {
+        batch->committed = 
+            ((OffblastBlobFile*) dbFileStruct->memory)->cursor;
+    }
+    else {
+        batch->committed = 
+            ((OffblastDbFileFormat*) dbFileStruct->memory)->nEntries;
+    }
+}
+
+void *reserveDbBatch(OffblastDbBatch *batch, size_t n) 
+{
+    size_t required = (batch->committed + batch->pending + n) 
+        * batch->itemSize;
+    size_t minimumGrowth;
+
+    if (batch->type == OFFBLAST_DB_TYPE_FIXED) {
+        // The header fits in the slack of one item
+        required += batch->itemSize;
+        minimumGrowth = batch->itemSize * ITEM_BUFFER_NUM;
+    }
+    else if (batch->type == OFFBLAST_DB_TYPE_BLOB) {
+        required += sizeof(OffblastBlobFile);
+        minimumGrowth = BLOB_GROW_SIZE;
+    }
+    else {
+        printf("wtf kind of db file are you using then?\n");
+        return NULL;
+    }
+
+    if (!reserveDbFileBytes(batch->file, required, minimumGrowth)) {
+        return NULL;
+    }
+
+    return batch->file->memory;
+}
+
+int commitDbBatch(OffblastDbBatch *batch) 
+{
+    if (batch->pending == 0) return 1;
+
+    if (batch->type == OFFBLAST_DB_TYPE_BLOB) {
+        ((OffblastBlobFile*) batch->file->memory)->cursor = 
+            batch->committed + batch->pending;
+    }
+    else {
+        ((OffblastDbFileFormat*) batch->file->memory)->nEntries = 
+            batch->committed + batch->pending;
+    }
+
+    batch->committed += batch->pending;
+    batch->pending = 0;
+
+    if (msync(batch->file->memory, batch->file->nBytesAllocated, 
+                MS_SYNC) == -1) 
+    {
+        perror("couldn't flush db file\n");
+        return 0;
     }
 
-    return dbFileStruct->memory;
+    return 1;
 }
 
 int32_t launchTargetIndexByTargetSignature(LaunchTargetFile *file, 
@@ -157,121 +347,4280 @@ int32_t launchTargetIndexByTargetSignature(LaunchTargetFile *file,
     return foundIndex;
 }
 
-int32_t launchTargetIndexByIdMatch(LaunchTargetFile *file,
-        char *idStr, char *platform)
+static size_t launchTargetIndexBytes(uint64_t nSlots)
 {
-    int32_t foundIndex = -1;
+    return sizeof(LaunchTargetIndexFile) 
+        + nSlots * sizeof(LaunchTargetIndexSlot);
+}
 
-    for (uint32_t i = 0; i < file->nEntries; i++) {
-        if (strcmp(file->entries[i].id, idStr) == 0
-                && strcmp(file->entries[i].platform, platform) == 0)
-        {
-            foundIndex = i;
-            break;
-        }
+// Lookups read the index under the read lock, appending targets and 
+// rebuilding take the write lock
+static pthread_rwlock_t indexLock = PTHREAD_RWLOCK_INITIALIZER;
+
+static void launchTargetIndexPut(LaunchTargetIndexFile *index, 
+        uint64_t targetSignature, uint32_t entryIndex)
+{
+    // Signatures are already murmur output so the low bits are good enough
+    uint64_t mask = index->nSlots - 1;
+    uint64_t slot = targetSignature & mask;
+
+    while (index->slots[slot].entryIndexPlusOne != 0) {
+        // Keep the first entry for a duplicate, same as the linear scan
+        if (index->slots[slot].targetSignature == targetSignature) return;
+        slot = (slot + 1) & mask;
     }
 
-    return foundIndex;
+    index->slots[slot].targetSignature = targetSignature;
+    index->slots[slot].entryIndexPlusOne = entryIndex + 1;
 }
 
+static int rebuildLaunchTargetIndexLocked(LaunchTargetDb *db)
+{
+    LaunchTargetFile *targets = (LaunchTargetFile*) db->targets.memory;
 
-int32_t launchTargetIndexByNameMatch(LaunchTargetFile *file, 
-        char *searchString, char *platform, float *matchScore) 
+    // Keep the load factor at or under a half
+    uint64_t nSlots = LAUNCH_TARGET_INDEX_MIN_SLOTS;
+    while (nSlots < (uint64_t) targets->nEntries * 2) nSlots <<= 1;
+
+    size_t nBytes = launchTargetIndexBytes(nSlots);
+    if (nBytes != db->index.nBytesAllocated 
+            && !resizeDbFile(&db->index, nBytes)) 
+    {
+        return 0;
+    }
+
+    LaunchTargetIndexFile *index = (LaunchTargetIndexFile*) db->index.memory;
+    memset(index, 0, nBytes);
+    index->version = LAUNCH_TARGET_INDEX_VERSION;
+    index->nSlots = nSlots;
+
+    for (uint32_t i = 0; i < targets->nEntries; i++) {
+        launchTargetIndexPut(index, targets->entries[i].targetSignature, i);
+    }
+
+    index->nIndexed = targets->nEntries;
+    index->lastSignature = targets->nEntries 
+        ? targets->entries[targets->nEntries-1].targetSignature : 0;
+
+    printf("indexed %u launch targets in %lu slots\n", 
+            index->nIndexed, nSlots);
+
+    return 1;
+}
+
+int rebuildLaunchTargetIndex(LaunchTargetDb *db)
 {
+    pthread_rwlock_wrlock(&indexLock);
+    int ok = rebuildLaunchTargetIndexLocked(db);
+    pthread_rwlock_unlock(&indexLock);
 
-    int32_t bestIndex = -1;
-    float bestScore = 0;
+    return ok;
+}
 
+// Picks up entries appended to the targets file since the last call, 
+// with the write lock held
+static int syncLaunchTargetIndex(LaunchTargetDb *db)
+{
+    LaunchTargetFile *targets = (LaunchTargetFile*) db->targets.memory;
+    LaunchTargetIndexFile *index = (LaunchTargetIndexFile*) db->index.memory;
 
-    printf("\nLooking for: %s\n--------------\n", searchString);
+    if (index->nIndexed == targets->nEntries) return 1;
 
-    for (uint32_t i = 0; i < file->nEntries; i++) {
+    if (index->nIndexed > targets->nEntries 
+            || (uint64_t) targets->nEntries * 2 > index->nSlots)
+    {
+        return rebuildLaunchTargetIndexLocked(db);
+    }
 
-        if (strcmp(file->entries[i].platform, platform) != 0) {
-            continue;
-        }
+    for (uint32_t i = index->nIndexed; i < targets->nEntries; i++) {
+        launchTargetIndexPut(index, targets->entries[i].targetSignature, i);
+    }
 
-        // File name needle match
-        char *workingCopy = strdup(searchString);
-        uint32_t tokensMatched = 0;
-        uint32_t numTokens = 0;
-        float score;
+    index->nIndexed = targets->nEntries;
+    index->lastSignature = 
+        targets->entries[targets->nEntries-1].targetSignature;
 
-        char *token = strtok(workingCopy, " ");
-        while(token != NULL) {
-            numTokens++;
-            if ((strcasestr(file->entries[i].name, token) != NULL)) {
-                //printf("Pass 1; Token Match: %s\n", token);
-                tokensMatched++;
-            }
-            token = strtok(NULL, " ");
-        }
-        free(workingCopy);
+    return 1;
+}
 
-        // Entry name needle match
-        workingCopy = strdup(file->entries[i].name);
-        token = strtok(workingCopy, " ");
-        while(token != NULL) {
-            numTokens++;
-            if ((strcasestr(searchString, token) != NULL)) {
-                //printf("Pass2: Token Match: %s\n", token);
-                tokensMatched++;
-            }
-            token = strtok(NULL, " ");
-        }
-        free(workingCopy);
+// A freshly created file is all zeroes so it fails the version check
+int launchTargetIndexUsable(LaunchTargetDb *db)
+{
+    LaunchTargetFile *targets = (LaunchTargetFile*) db->targets.memory;
+    LaunchTargetIndexFile *index = (LaunchTargetIndexFile*) db->index.memory;
 
-        if (tokensMatched >= 1) {
-            score = (float)tokensMatched/numTokens;
-            //printf("%s\t%s\n", searchString, file->entries[i].name);
-            //printf("Matched %u/%u for a score of %f\n", 
-            //        tokensMatched, numTokens, score);
+    return index != NULL
+        && db->index.nBytesAllocated >= sizeof(LaunchTargetIndexFile)
+        && index->version == LAUNCH_TARGET_INDEX_VERSION
+        && index->nSlots != 0
+        && (index->nSlots & (index->nSlots - 1)) == 0
+        && launchTargetIndexBytes(index->nSlots) 
+            <= db->index.nBytesAllocated
+        && index->nIndexed <= targets->nEntries
+        && (index->nIndexed == 0 
+            || targets->entries[index->nIndexed-1].targetSignature 
+                == index->lastSignature);
+}
 
-            if (score == bestScore) {
-                //printf("\n--CONFLICT not sure which is best, "
-                //        "doing nothing!--\n");
-            }
-            else if (score > bestScore) {
+static int initLaunchTargetIndex(char *path, LaunchTargetDb *db)
+{
+    if (!InitDbFile(path, &db->index, sizeof(LaunchTargetIndexSlot))) {
+        return 0;
+    }
 
-                bestScore = score;
-                *matchScore = bestScore;
+    if (!launchTargetIndexUsable(db)) {
+        printf("launch target index missing or stale, rebuilding\n");
+        return rebuildLaunchTargetIndexLocked(db);
+    }
 
-                bestIndex = i;
+    return syncLaunchTargetIndex(db);
+}
+
+// Commits a batch of appended targets and adds them to the index, so 
+// lookups never have to write
+int commitLaunchTargetBatch(LaunchTargetDb *db, OffblastDbBatch *batch)
+{
+    pthread_rwlock_wrlock(&indexLock);
+
+    int ok = commitDbBatch(batch);
+    if (db->index.memory && !syncLaunchTargetIndex(db)) {
+        printf("couldn't index the appended launch targets\n");
+    }
+
+    pthread_rwlock_unlock(&indexLock);
+
+    return ok;
+}
+
+// Only reads, the index is kept up to date by commitLaunchTargetBatch. 
+// Falls back to the linear scan if the index is missing or behind.
+int32_t launchTargetIndexLookup(LaunchTargetDb *db, uint64_t targetSignature)
+{
+    LaunchTargetFile *targets = (LaunchTargetFile*) db->targets.memory;
+
+    pthread_rwlock_rdlock(&indexLock);
+
+    LaunchTargetIndexFile *index = (LaunchTargetIndexFile*) db->index.memory;
+    if (index == NULL || index->nIndexed != targets->nEntries) {
+        pthread_rwlock_unlock(&indexLock);
+        return launchTargetIndexByTargetSignature(targets, targetSignature);
+    }
+
+    uint64_t mask = index->nSlots - 1;
+    uint64_t slot = targetSignature & mask;
+    int32_t found = -1;
+
+    while (index->slots[slot].entryIndexPlusOne != 0) {
+        if (index->slots[slot].targetSignature == targetSignature) {
+
+            uint32_t entryIndex = index->slots[slot].entryIndexPlusOne - 1;
+            if (entryIndex < targets->nEntries 
+                    && targets->entries[entryIndex].targetSignature 
+                        == targetSignature) 
+            {
+                found = entryIndex;
+            }
+            else {
+                printf("launch target index out of step\n");
+                found = -2;
             }
+            break;
         }
+        slot = (slot + 1) & mask;
     }
 
-    if (bestIndex == -1) {
-        printf("NOT FOUND\n\n");
-    }
-    else {
-        printf("best match: %s - index %u\n\n",
-                file->entries[bestIndex].name, bestIndex);
+    pthread_rwlock_unlock(&indexLock);
+
+    if (found == -2) {
+        return launchTargetIndexByTargetSignature(targets, targetSignature);
     }
 
-    return bestIndex;
+    return found;
+}
+
+// Offset 0 always holds the empty string
+char *launchTargetString(LaunchTargetDb *db, uint32_t offset)
+{
+    OffblastBlobFile *heap = (OffblastBlobFile*) db->strings.memory;
+    return &heap->memory[offset];
 }
 
+static pthread_mutex_t stringLock = PTHREAD_MUTEX_INITIALIZER;
 
-int32_t launchTargetIndexByFieldMatch(LaunchTargetFile *file,
-        char *fieldName, char *searchValue, char *platform, float *matchScore)
+// Always appends. Strings are read without a lock, by the render thread 
+// among others, so one that's been handed out is never written again.
+// Returns LAUNCH_TARGET_STRING_FAILED if the heap is full or can't grow.
+uint32_t storeLaunchTargetString(LaunchTargetDb *db, uint32_t offset,
+        const char *value, size_t maxLength)
 {
-    if (strcmp(fieldName, "title_id") == 0) {
-        // Match against ID field in database (exact match)
-        int32_t result = launchTargetIndexByIdMatch(file, searchValue, platform);
-        if (result > -1 && matchScore != NULL) {
-            *matchScore = 1.0;  // ID matches are exact matches
-        }
-        return result;
+    if (value == NULL || value[0] == '\0') return 0;
+
+    size_t length = strnlen(value, maxLength);
+
+    // Rescans and rescrapes mostly store what's already there
+    if (offset != 0 
+            && strncmp(launchTargetString(db, offset), value, length) == 0
+            && launchTargetString(db, offset)[length] == '\0') 
+    {
+        return offset;
     }
-    else if (strcmp(fieldName, "title") == 0) {
-        // Match against title/name field (default behavior)
-        return launchTargetIndexByNameMatch(file, searchValue, platform, matchScore);
+
+    pthread_mutex_lock(&stringLock);
+
+    OffblastBlobFile *heap = (OffblastBlobFile*) db->strings.memory;
+    if ((size_t) heap->cursor + length + 1 > UINT32_MAX) {
+        printf("launch target string heap is full, it will be compacted "
+                "on the next start\n");
+        pthread_mutex_unlock(&stringLock);
+        return LAUNCH_TARGET_STRING_FAILED;
     }
-    else {
-        // Unknown field type - fall back to title matching with warning
-        printf("WARNING: Unknown match_field '%s', falling back to title matching\n",
-                fieldName);
-        return launchTargetIndexByNameMatch(file, searchValue, platform, matchScore);
+
+    void *pHeap = growDbFileIfNecessary(&db->strings, 
+            sizeof(OffblastBlobFile) + length + 1,
+            OFFBLAST_DB_TYPE_BLOB);
+
+    if (pHeap == NULL) {
+        printf("couldn't grow the launch target string heap\n");
+        pthread_mutex_unlock(&stringLock);
+        return LAUNCH_TARGET_STRING_FAILED;
+    }
+
+    heap = (OffblastBlobFile*) pHeap;
+    uint32_t newOffset = heap->cursor;
+    memcpy(&heap->memory[newOffset], value, length);
+    heap->memory[newOffset + length] = '\0';
+    heap->cursor += length + 1;
+
+    pthread_mutex_unlock(&stringLock);
+
+    return newOffset;
+}
+
+// Guards the dictionary, which can grow from any thread that interns a 
+// new platform or owner
+static pthread_mutex_t dictLock = PTHREAD_MUTEX_INITIALIZER;
+
+// The dictionary only ever holds a few dozen platforms and owners so a
+// linear scan is fine, callers resolve an id once and compare integers
+static uint16_t findDictEntry(LaunchTargetDictFile *dict, const char *value)
+{
+    for (uint32_t i = 0; i < dict->nEntries; i++) {
+        if (strcmp(dict->entries[i].value, value) == 0) return i + 1;
     }
+
+    return LAUNCH_TARGET_DICT_MISSING;
+}
+
+uint16_t launchTargetDictLookup(LaunchTargetDb *db, const char *value)
+{
+    if (value == NULL || value[0] == '\0') return 0;
+
+    pthread_mutex_lock(&dictLock);
+    uint16_t id = findDictEntry(
+            (LaunchTargetDictFile*) db->dictionary.memory, value);
+    pthread_mutex_unlock(&dictLock);
+
+    return id;
+}
+
+uint16_t launchTargetDictId(LaunchTargetDb *db, const char *value)
+{
+    if (value == NULL || value[0] == '\0') return 0;
+
+    pthread_mutex_lock(&dictLock);
+
+    uint16_t id = findDictEntry(
+            (LaunchTargetDictFile*) db->dictionary.memory, value);
+    if (id == LAUNCH_TARGET_DICT_MISSING) {
+
+        LaunchTargetDictFile *dict = (LaunchTargetDictFile*) 
+            growDbFileIfNecessary(&db->dictionary, 
+                    sizeof(LaunchTargetDictEntry), OFFBLAST_DB_TYPE_FIXED);
+
+        if (dict == NULL || dict->nEntries + 1 >= LAUNCH_TARGET_DICT_MISSING) {
+            printf("couldn't add %s to the launch target dictionary\n", 
+                    value);
+            id = 0;
+        }
+        else {
+            LaunchTargetDictEntry *entry = &dict->entries[dict->nEntries];
+            memset(entry, 0, sizeof(LaunchTargetDictEntry));
+            strncpy(entry->value, value, LAUNCH_TARGET_DICT_VALUE_MAX - 1);
+            dict->nEntries++;
+            id = dict->nEntries;
+        }
+    }
+
+    pthread_mutex_unlock(&dictLock);
+
+    return id;
+}
+
+// Entries never change once added and the file doesn't move as it grows, so
+// the value stays good after the lock is dropped
+char *launchTargetDictValue(LaunchTargetDb *db, uint16_t id)
+{
+    pthread_mutex_lock(&dictLock);
+
+    LaunchTargetDictFile *dict = (LaunchTargetDictFile*) db->dictionary.memory;
+    char *value = "";
+    if (id != 0 && id <= dict->nEntries) value = dict->entries[id - 1].value;
+
+    pthread_mutex_unlock(&dictLock);
+
+    return value;
+}
+
+// Old record formats, only kept around to migrate existing files
+typedef struct LaunchTargetV1 {
+    uint64_t targetSignature;
+
+    char id[OFFBLAST_NAME_MAX];
+    char name[OFFBLAST_NAME_MAX];
+    char date[10];
+    uint32_t ranking;
+
+    char path[PATH_MAX];
+    float matchScore;
+    char platform[256];
+    uint32_t launcherSignature;
+
+    char coverUrl[PATH_MAX];
+    off_t descriptionOffset;
+
+    char ownerTag[64];
+} LaunchTargetV1;
+
+typedef struct LaunchTargetV2 {
+    uint64_t targetSignature;
+
+    uint32_t idOffset;
+    uint32_t nameOffset;
+    uint32_t pathOffset;
+    uint32_t coverUrlOffset;
+
+    char date[10];
+    uint32_t ranking;
+
+    float matchScore;
+    char platform[256];
+    uint32_t launcherSignature;
+
+    off_t descriptionOffset;
+
+    char ownerTag[64];
+} LaunchTargetV2;
+
+typedef struct LaunchTargetV3 {
+    uint64_t targetSignature;
+    uint32_t launcherSignature;
+    uint32_t ranking;
+
+    uint32_t nameOffset;
+    uint16_t flags;
+    char date[10];
+
+    char platform[256];
+    char ownerTag[64];
+} LaunchTargetV3;
+
+static size_t launchTargetRecordSize(uint32_t version)
+{
+    switch (version) {
+        case 1: return sizeof(LaunchTargetV1);
+        case 2: return sizeof(LaunchTargetV2);
+        case 3: return sizeof(LaunchTargetV3);
+        default: return sizeof(LaunchTarget);
+    }
+}
+
+// Rewrites the hot file in the current format. Every old format has its
+// entries 8 bytes in, straight after nEntries and the version word
+static int migrateLaunchTargets(char *path, LaunchTargetDb *db, 
+        uint32_t fromVersion)
+{
+    char *oldMemory = (char*) db->targets.memory;
+    uint32_t nEntries = ((LaunchTargetFile*) oldMemory)->nEntries;
+    size_t oldRecordSize = launchTargetRecordSize(fromVersion);
+    char *oldEntries = oldMemory + sizeof(LaunchTargetFile);
+
+    if (sizeof(LaunchTargetFile) + nEntries * oldRecordSize 
+            > db->targets.nBytesAllocated) 
+    {
+        printf("launch target db looks truncated, not migrating it\n");
+        return 0;
+    }
+
+    printf("migrating %u launch targets from v%u to v%d\n", 
+            nEntries, fromVersion, LAUNCH_TARGET_VERSION);
+
+    // Build the new file beside the old one and swap it in at the end so
+    // that a crash halfway through leaves the old file untouched
+    char *tmpPath;
+    asprintf(&tmpPath, "%s.migrating", path);
+    unlink(tmpPath);
+
+    OffblastDbFile newDb = {0};
+    size_t nBytes = sizeof(LaunchTargetFile) 
+        + ((size_t) nEntries + ITEM_BUFFER_NUM) * sizeof(LaunchTarget);
+    size_t nColdBytes = sizeof(LaunchTargetColdFile) 
+        + ((size_t) nEntries + ITEM_BUFFER_NUM) * sizeof(LaunchTargetCold);
+
+    if (!InitDbFile(tmpPath, &newDb, sizeof(LaunchTarget)) 
+            || !resizeDbFile(&newDb, nBytes))
+    {
+        printf("couldn't create %s\n", tmpPath);
+        free(tmpPath);
+        return 0;
+    }
+
+    // v3 already has the cold file, older formats carried it inline
+    if (fromVersion < 3) {
+        if (!resizeDbFile(&db->cold, nColdBytes)) {
+            printf("couldn't create the launch target cold file\n");
+            free(tmpPath);
+            return 0;
+        }
+        memset(db->cold.memory, 0, nColdBytes);
+    }
+
+    LaunchTargetFile *newFile = (LaunchTargetFile*) newDb.memory;
+    LaunchTargetColdFile *coldFile = (LaunchTargetColdFile*) db->cold.memory;
+
+    for (uint32_t i = 0; i < nEntries; i++) {
+        void *from = oldEntries + i * oldRecordSize;
+        LaunchTarget *to = &newFile->entries[i];
+        LaunchTargetCold *toCold = &coldFile->entries[i];
+        const char *fromPlatform;
+        const char *fromOwnerTag;
+
+        if (fromVersion == 1) {
+            LaunchTargetV1 *v1 = from;
+
+            to->targetSignature = v1->targetSignature;
+            to->launcherSignature = v1->launcherSignature;
+            to->ranking = v1->ranking;
+            to->nameOffset = storeLaunchTargetString(db, 0, 
+                    v1->name, sizeof(v1->name) - 1);
+            memcpy(to->date, v1->date, sizeof(to->date));
+            fromPlatform = v1->platform;
+            fromOwnerTag = v1->ownerTag;
+
+            toCold->idOffset = storeLaunchTargetString(db, 0, 
+                    v1->id, sizeof(v1->id) - 1);
+            toCold->pathOffset = storeLaunchTargetString(db, 0, 
+                    v1->path, sizeof(v1->path) - 1);
+            toCold->coverUrlOffset = storeLaunchTargetString(db, 0, 
+                    v1->coverUrl, sizeof(v1->coverUrl) - 1);
+            toCold->matchScore = v1->matchScore;
+            toCold->descriptionOffset = v1->descriptionOffset;
+
+            if (to->nameOffset == LAUNCH_TARGET_STRING_FAILED
+                    || toCold->idOffset == LAUNCH_TARGET_STRING_FAILED
+                    || toCold->pathOffset == LAUNCH_TARGET_STRING_FAILED
+                    || toCold->coverUrlOffset == LAUNCH_TARGET_STRING_FAILED)
+            {
+                printf("couldn't move the launch target strings\n");
+                closeDbFile(&newDb);
+                unlink(tmpPath);
+                free(tmpPath);
+                return 0;
+            }
+        }
+        else if (fromVersion == 2) {
+            LaunchTargetV2 *v2 = from;
+
+            to->targetSignature = v2->targetSignature;
+            to->launcherSignature = v2->launcherSignature;
+            to->ranking = v2->ranking;
+            to->nameOffset = v2->nameOffset;
+            memcpy(to->date, v2->date, sizeof(to->date));
+            fromPlatform = v2->platform;
+            fromOwnerTag = v2->ownerTag;
+
+            toCold->idOffset = v2->idOffset;
+            toCold->pathOffset = v2->pathOffset;
+            toCold->coverUrlOffset = v2->coverUrlOffset;
+            toCold->matchScore = v2->matchScore;
+            toCold->descriptionOffset = v2->descriptionOffset;
+        }
+        else {
+            LaunchTargetV3 *v3 = from;
+
+            to->targetSignature = v3->targetSignature;
+            to->launcherSignature = v3->launcherSignature;
+            to->ranking = v3->ranking;
+            to->nameOffset = v3->nameOffset;
+            to->flags = v3->flags;
+            memcpy(to->date, v3->date, sizeof(to->date));
+            fromPlatform = v3->platform;
+            fromOwnerTag = v3->ownerTag;
+        }
+
+        // Terminated in the copy, the old file is left as it was in case 
+        // the migration doesn't finish
+        char platform[256];
+        char ownerTag[64];
+        memcpy(platform, fromPlatform, sizeof(platform) - 1);
+        platform[sizeof(platform) - 1] = '\0';
+        memcpy(ownerTag, fromOwnerTag, sizeof(ownerTag) - 1);
+        ownerTag[sizeof(ownerTag) - 1] = '\0';
+
+        to->platformId = launchTargetDictId(db, platform);
+        to->ownerId = launchTargetDictId(db, ownerTag);
+
+        if (fromVersion < 3 
+                && launchTargetString(db, toCold->pathOffset)[0] != '\0') 
+        {
+            to->flags |= LAUNCH_TARGET_INSTALLED;
+        }
+    }
+
+    newFile->nEntries = nEntries;
+    newFile->version = LAUNCH_TARGET_VERSION;
+    if (fromVersion < 3) coldFile->nEntries = nEntries;
+
+    msync(db->strings.memory, db->strings.nBytesAllocated, MS_SYNC);
+    msync(db->dictionary.memory, db->dictionary.nBytesAllocated, MS_SYNC);
+    msync(db->cold.memory, db->cold.nBytesAllocated, MS_SYNC);
+    msync(newDb.memory, newDb.nBytesAllocated, MS_SYNC);
+
+    if (rename(tmpPath, path) == -1) {
+        perror("couldn't replace the old launch target db\n");
+        closeDbFile(&newDb);
+        free(tmpPath);
+        return 0;
+    }
+    free(tmpPath);
+
+    closeDbFile(&db->targets);
+    db->targets = newDb;
+
+    printf("migration complete, %lu bytes of targets\n", nBytes);
+
+    return 1;
+}
+
+// Every target's new string offsets, written and synced before the 
+// compacted heap replaces the old one. If it's still there on startup the 
+// swap didn't finish and is finished from it.
+#define LAUNCH_STRING_REMAP_MAGIC 0x50525453
+#define LAUNCH_STRING_COLUMNS 4
+
+typedef struct LaunchStringRemapHeader {
+    uint32_t magic;
+    uint32_t nEntries;
+} LaunchStringRemapHeader;
+
+// The name, id, path and cover url offsets, in that order. A target 
+// without a cold record only has a name.
+static void launchTargetStringOffsets(LaunchTargetDb *db, uint32_t i, 
+        uint32_t *offsets)
+{
+    LaunchTargetFile *targets = (LaunchTargetFile*) db->targets.memory;
+    LaunchTargetColdFile *cold = (LaunchTargetColdFile*) db->cold.memory;
+
+    memset(offsets, 0, LAUNCH_STRING_COLUMNS * sizeof(uint32_t));
+    offsets[0] = targets->entries[i].nameOffset;
+    if (i >= cold->nEntries) return;
+
+    offsets[1] = cold->entries[i].idOffset;
+    offsets[2] = cold->entries[i].pathOffset;
+    offsets[3] = cold->entries[i].coverUrlOffset;
+}
+
+static int applyLaunchStringRemap(LaunchTargetDb *db, uint32_t *offsets, 
+        uint32_t nEntries)
+{
+    LaunchTargetFile *targets = (LaunchTargetFile*) db->targets.memory;
+    LaunchTargetColdFile *cold = (LaunchTargetColdFile*) db->cold.memory;
+    if (nEntries > targets->nEntries) return 0;
+
+    for (uint32_t i = 0; i < nEntries; ++i) {
+        uint32_t *remapped = &offsets[(size_t) i * LAUNCH_STRING_COLUMNS];
+        targets->entries[i].nameOffset = remapped[0];
+        if (i >= cold->nEntries) continue;
+
+        cold->entries[i].idOffset = remapped[1];
+        cold->entries[i].pathOffset = remapped[2];
+        cold->entries[i].coverUrlOffset = remapped[3];
+    }
+
+    return msync(db->targets.memory, db->targets.nBytesAllocated, 
+                MS_SYNC) == 0
+        && msync(db->cold.memory, db->cold.nBytesAllocated, MS_SYNC) == 0;
+}
+
+static int writeLaunchStringRemap(const char *remapPath, uint32_t *offsets, 
+        uint32_t nEntries)
+{
+    FILE *remap = fopen(remapPath, "wb");
+    if (!remap) return 0;
+
+    size_t nOffsets = (size_t) nEntries * LAUNCH_STRING_COLUMNS;
+    LaunchStringRemapHeader header = {LAUNCH_STRING_REMAP_MAGIC, nEntries};
+    int ok = fwrite(&header, sizeof(header), 1, remap) == 1
+        && fwrite(offsets, sizeof(uint32_t), nOffsets, remap) == nOffsets
+        && fflush(remap) == 0
+        && fsync(fileno(remap)) == 0;
+
+    ok = (fclose(remap) == 0) && ok;
+    if (!ok) unlink(remapPath);
+
+    return ok;
+}
+
+// Swaps in the heap of an interrupted compaction before it's opened. The 
+// remap is handed back to be applied once the targets are, *offsets is 
+// left NULL when there's nothing to finish.
+static int recoverLaunchStringCompaction(const char *stringsPath, 
+        uint32_t **offsets, uint32_t *nEntries)
+{
+    char *compactedPath;
+    char *remapPath;
+    asprintf(&compactedPath, "%s.compacting", stringsPath);
+    asprintf(&remapPath, "%s.remap", stringsPath);
+
+    *offsets = NULL;
+    *nEntries = 0;
+
+    int ok = 1;
+    FILE *remap = fopen(remapPath, "rb");
+
+    if (remap) {
+        LaunchStringRemapHeader header;
+        uint32_t *remapped = NULL;
+        size_t nOffsets = 0;
+
+        // A remap that's short never got as far as the swap
+        int complete = fread(&header, sizeof(header), 1, remap) == 1
+            && header.magic == LAUNCH_STRING_REMAP_MAGIC;
+        if (complete) {
+            nOffsets = (size_t) header.nEntries * LAUNCH_STRING_COLUMNS;
+            remapped = malloc((nOffsets + 1) * sizeof(uint32_t));
+            complete = remapped != NULL
+                && fread(remapped, sizeof(uint32_t), nOffsets, remap) 
+                    == nOffsets;
+        }
+        fclose(remap);
+
+        if (!complete) {
+            free(remapped);
+            unlink(remapPath);
+        }
+        else {
+            printf("finishing an interrupted launch target string "
+                    "compaction\n");
+            if (access(compactedPath, F_OK) == 0 
+                    && rename(compactedPath, stringsPath) == -1) 
+            {
+                perror("couldn't swap in the compacted launch target "
+                        "strings\n");
+                free(remapped);
+                ok = 0;
+            }
+            else {
+                *offsets = remapped;
+                *nEntries = header.nEntries;
+            }
+        }
+    }
+
+    // Whatever is left was never swapped in
+    if (ok) unlink(compactedPath);
+
+    free(compactedPath);
+    free(remapPath);
+    return ok;
+}
+
+static int openLaunchTargetFiles(char *configPath, LaunchTargetDb *db)
+{
+    char *targetsPath;
+    char *coldPath;
+    char *stringsPath;
+    char *dictionaryPath;
+    asprintf(&targetsPath, "%s/launchtargets.bin", configPath);
+    asprintf(&coldPath, "%s/launchtargets.cold", configPath);
+    asprintf(&stringsPath, "%s/launchstrings.bin", configPath);
+    asprintf(&dictionaryPath, "%s/launchdictionary.bin", configPath);
+
+    uint32_t *stringRemap;
+    uint32_t nStringRemap;
+    int ok = recoverLaunchStringCompaction(stringsPath, &stringRemap, 
+                &nStringRemap)
+        && InitDbFile(stringsPath, &db->strings, 1)
+        && InitDbFile(dictionaryPath, &db->dictionary, 
+                sizeof(LaunchTargetDictEntry))
+        && InitDbFile(coldPath, &db->cold, sizeof(LaunchTargetCold))
+        && InitDbFile(targetsPath, &db->targets, sizeof(LaunchTarget));
+
+    if (ok) {
+        LaunchTargetFile *targets = (LaunchTargetFile*) db->targets.memory;
+        LaunchTargetColdFile *cold = (LaunchTargetColdFile*) db->cold.memory;
+        OffblastBlobFile *strings = (OffblastBlobFile*) db->strings.memory;
+        uint32_t version = targets->version;
+
+        if (version == LAUNCH_TARGET_VERSION) {
+
+            // The targets still point into the heap that was swapped out
+            if (stringRemap) {
+                if (applyLaunchStringRemap(db, stringRemap, nStringRemap)) {
+                    char *remapPath;
+                    asprintf(&remapPath, "%s.remap", stringsPath);
+                    unlink(remapPath);
+                    free(remapPath);
+                }
+                else {
+                    printf("couldn't patch the launch target string "
+                            "offsets\n");
+                    ok = 0;
+                }
+            }
+
+            if (strings->cursor == 0) {
+                printf("launch target string heap is missing, names and "
+                        "paths will be empty until the next rescan\n");
+                strings->cursor = 1;
+            }
+
+            // Cold records past the end of the hot file belong to targets
+            // that no longer exist, clear them so new ones don't inherit them
+            if (cold->nEntries > targets->nEntries) {
+                memset(&cold->entries[targets->nEntries], 0, 
+                        (cold->nEntries - targets->nEntries) 
+                            * sizeof(LaunchTargetCold));
+                cold->nEntries = targets->nEntries;
+            }
+            else if (cold->nEntries < targets->nEntries) {
+                printf("launch target cold file is missing %u records\n",
+                        targets->nEntries - cold->nEntries);
+                ok = ok && appendLaunchTargetCold(db, 
+                        &targets->entries[targets->nEntries - 1]) != NULL;
+            }
+        }
+        else if (version > LAUNCH_TARGET_VERSION || version == 1) {
+            printf("unknown launch target db version %u\n", version);
+            ok = 0;
+        }
+        else {
+            // Both a brand new file and a v1 one start with a fresh heap
+            if (version == 0) {
+                strings->memory[0] = '\0';
+                strings->cursor = 1;
+            }
+
+            if (targets->nEntries == 0) {
+                memset(cold->entries, 0, 
+                        cold->nEntries * sizeof(LaunchTargetCold));
+                cold->nEntries = 0;
+                targets->version = LAUNCH_TARGET_VERSION;
+            }
+            else {
+                ok = migrateLaunchTargets(targetsPath, db, 
+                        version == 0 ? 1 : version);
+            }
+        }
+    }
+
+    free(stringRemap);
+    free(targetsPath);
+    free(coldPath);
+    free(stringsPath);
+    free(dictionaryPath);
+
+    return ok;
+}
+
+int InitLaunchTargetDb(char *configPath, LaunchTargetDb *db)
+{
+    if (!openLaunchTargetFiles(configPath, db)) return 0;
+
+    // Lookups fall back to a linear scan without the index
+    char *indexPath;
+    asprintf(&indexPath, "%s/launchtargets.idx", configPath);
+    if (!initLaunchTargetIndex(indexPath, db)) {
+        printf("couldn't initialize the launch target index\n");
+        db->index = (OffblastDbFile){0};
+    }
+    free(indexPath);
+
+    char *shardsPath;
+    asprintf(&shardsPath, "%s/launchshards.bin", configPath);
+    int ok = InitDbFile(shardsPath, &db->shards, sizeof(LaunchTargetShard));
+    free(shardsPath);
+    if (!ok) return 0;
+
+    LaunchTargetShardFile *shards = (LaunchTargetShardFile*) db->shards.memory;
+    if (shards->version != LAUNCH_TARGET_SHARD_VERSION) {
+        if (shards->version > LAUNCH_TARGET_SHARD_VERSION 
+                && shards->nEntries != 0) 
+        {
+            printf("unknown launch target shard version %u\n", 
+                    shards->version);
+            return 0;
+        }
+
+        // Older shards fail to read and are dropped when they're needed, 
+        // their platforms are then imported again
+        shards->version = LAUNCH_TARGET_SHARD_VERSION;
+        msync(db->shards.memory, db->shards.nBytesAllocated, MS_SYNC);
+    }
+
+    return 1;
+}
+
+// Maps the launch target files read only, for reports that mustn't change 
+// what they're reporting on. Unlike InitLaunchTargetDb nothing is created, 
+// migrated, synced or repaired, and a db in any other version than this 
+// one is refused. The index and shard list are left unmapped if missing.
+int openLaunchTargetDbReadOnly(char *configPath, LaunchTargetDb *db)
+{
+    memset(db, 0, sizeof(LaunchTargetDb));
+
+    char *targetsPath;
+    char *coldPath;
+    char *stringsPath;
+    char *dictionaryPath;
+    char *indexPath;
+    char *shardsPath;
+    asprintf(&targetsPath, "%s/launchtargets.bin", configPath);
+    asprintf(&coldPath, "%s/launchtargets.cold", configPath);
+    asprintf(&stringsPath, "%s/launchstrings.bin", configPath);
+    asprintf(&dictionaryPath, "%s/launchdictionary.bin", configPath);
+    asprintf(&indexPath, "%s/launchtargets.idx", configPath);
+    asprintf(&shardsPath, "%s/launchshards.bin", configPath);
+
+    int ok = openDbFileReadOnly(targetsPath, &db->targets, 
+            sizeof(LaunchTargetFile));
+    if (!ok) printf("couldn't open %s\n", targetsPath);
+
+    if (ok) {
+        uint32_t version = ((LaunchTargetFile*) db->targets.memory)->version;
+        if (version > LAUNCH_TARGET_VERSION || version == 1) {
+            printf("unknown launch target db version %u\n", version);
+            ok = 0;
+        }
+        else if (version != LAUNCH_TARGET_VERSION) {
+            printf("launch target db is v%u, OffBlast migrates it to v%d "
+                    "when it next starts\n", version, LAUNCH_TARGET_VERSION);
+            ok = 0;
+        }
+    }
+
+    if (ok) {
+        ok = openDbFileReadOnly(coldPath, &db->cold, 
+                    sizeof(LaunchTargetColdFile))
+            && openDbFileReadOnly(stringsPath, &db->strings, 
+                    sizeof(OffblastBlobFile) + 1)
+            && openDbFileReadOnly(dictionaryPath, &db->dictionary, 
+                    sizeof(LaunchTargetDictFile));
+        if (!ok) printf("couldn't open every launch target file\n");
+    }
+
+    if (ok) {
+        openDbFileReadOnly(indexPath, &db->index, 
+                sizeof(LaunchTargetIndexFile));
+        openDbFileReadOnly(shardsPath, &db->shards, 
+                sizeof(LaunchTargetShardFile));
+    }
+    else {
+        OffblastDbFile *files[] = {&db->targets, &db->cold, &db->strings, 
+            &db->dictionary};
+        for (uint32_t i = 0; i < sizeof(files) / sizeof(files[0]); ++i) {
+            if (files[i]->memory) closeDbFile(files[i]);
+        }
+    }
+
+    free(targetsPath);
+    free(coldPath);
+    free(stringsPath);
+    free(dictionaryPath);
+    free(indexPath);
+    free(shardsPath);
+
+    return ok;
+}
+
+static pthread_mutex_t coldLock = PTHREAD_MUTEX_INITIALIZER;
+
+// Only reads, so it's safe from the render thread. Targets get their cold 
+// record when they're appended, a target without one reads as empty. 
+// Writers go through appendLaunchTargetCold, which creates it.
+const LaunchTargetCold *launchTargetCold(LaunchTargetDb *db, 
+        LaunchTarget *target)
+{
+    static const LaunchTargetCold missingCold;
+
+    LaunchTargetFile *targets = (LaunchTargetFile*) db->targets.memory;
+    LaunchTargetColdFile *cold = (LaunchTargetColdFile*) db->cold.memory;
+    uint32_t index = target - targets->entries;
+
+    if (index >= cold->nEntries) return &missingCold;
+
+    return &cold->entries[index];
+}
+
+// Creates cleared cold records up to and including the one for target, 
+// for the writer that's appending it
+LaunchTargetCold *appendLaunchTargetCold(LaunchTargetDb *db, 
+        LaunchTarget *target)
+{
+    LaunchTargetFile *targets = (LaunchTargetFile*) db->targets.memory;
+    uint32_t index = target - targets->entries;
+
+    pthread_mutex_lock(&coldLock);
+
+    LaunchTargetColdFile *cold = (LaunchTargetColdFile*) db->cold.memory;
+    if (cold->nEntries <= index) {
+
+        OffblastDbBatch batch;
+        beginDbBatch(&batch, &db->cold, sizeof(LaunchTargetCold), 
+                OFFBLAST_DB_TYPE_FIXED);
+
+        uint32_t nMissing = index + 1 - cold->nEntries;
+        cold = (LaunchTargetColdFile*) reserveDbBatch(&batch, nMissing);
+        if (cold == NULL) {
+            printf("couldn't grow the launch target cold file\n");
+            pthread_mutex_unlock(&coldLock);
+            return NULL;
+        }
+
+        // Synced along with the targets they belong to
+        memset(&cold->entries[cold->nEntries], 0, 
+                nMissing * sizeof(LaunchTargetCold));
+        cold->nEntries += nMissing;
+    }
+
+    pthread_mutex_unlock(&coldLock);
+
+    return &cold->entries[index];
+}
+
+// Retired targets are kept for their paths and play time but never 
+// matched against again
+static int launchTargetMatchable(LaunchTarget *target, uint16_t platformId)
+{
+    return target->platformId == platformId 
+        && !(target->flags & LAUNCH_TARGET_RETIRED);
+}
+
+int32_t launchTargetIndexByIdMatch(LaunchTargetDb *db,
+        char *idStr, char *platform)
+{
+    LaunchTargetFile *file = (LaunchTargetFile*) db->targets.memory;
+    uint16_t platformId = launchTargetDictLookup(db, platform);
+    int32_t foundIndex = -1;
+
+    for (uint32_t i = 0; i < file->nEntries; i++) {
+        if (!launchTargetMatchable(&file->entries[i], platformId)) continue;
+
+        const LaunchTargetCold *cold = launchTargetCold(db, &file->entries[i]);
+
+        if (cold != NULL 
+                && strcmp(launchTargetString(db, cold->idOffset), idStr) == 0)
+        {
+            foundIndex = i;
+            break;
+        }
+    }
+
+    return foundIndex;
+}
+
+
+int32_t launchTargetIndexByNameMatch(LaunchTargetDb *db, 
+        char *searchString, char *platform, float *matchScore) 
+{
+    LaunchTargetFile *file = (LaunchTargetFile*) db->targets.memory;
+    uint16_t platformId = launchTargetDictLookup(db, platform);
+
+    int32_t bestIndex = -1;
+    float bestScore = 0;
+
+
+    printf("\nLooking for: %s\n--------------\n", searchString);
+
+    for (uint32_t i = 0; i < file->nEntries; i++) {
+
+        if (!launchTargetMatchable(&file->entries[i], platformId)) {
+            continue;
+        }
+
+        char *entryName = launchTargetString(db, 
+                file->entries[i].nameOffset);
+
+        // File name needle match
+        char *workingCopy = strdup(searchString);
+        uint32_t tokensMatched = 0;
+        uint32_t numTokens = 0;
+        float score;
+
+        char *saveptr;
+        char *token = strtok_r(workingCopy, " ", &saveptr);
+        while(token != NULL) {
+            numTokens++;
+            if ((strcasestr(entryName, token) != NULL)) {
+                //printf("Pass 1; Token Match: %s\n", token);
+                tokensMatched++;
+            }
+            token = strtok_r(NULL, " ", &saveptr);
+        }
+        free(workingCopy);
+
+        // Entry name needle match
+        workingCopy = strdup(entryName);
+        token = strtok_r(workingCopy, " ", &saveptr);
+        while(token != NULL) {
+            numTokens++;
+            if ((strcasestr(searchString, token) != NULL)) {
+                //printf("Pass2: Token Match: %s\n", token);
+                tokensMatched++;
+            }
+            token = strtok_r(NULL, " ", &saveptr);
+        }
+        free(workingCopy);
+
+        if (tokensMatched >= 1) {
+            score = (float)tokensMatched/numTokens;
+            //printf("%s\t%s\n", searchString, entryName);
+            //printf("Matched %u/%u for a score of %f\n", 
+            //        tokensMatched, numTokens, score);
+
+            if (score == bestScore) {
+                //printf("\n--CONFLICT not sure which is best, "
+                //        "doing nothing!--\n");
+            }
+            else if (score > bestScore) {
+
+                bestScore = score;
+                *matchScore = bestScore;
+
+                bestIndex = i;
+            }
+        }
+    }
+
+    if (bestIndex == -1) {
+        printf("NOT FOUND\n\n");
+    }
+    else {
+        printf("best match: %s - index %u\n\n",
+                launchTargetString(db, 
+                    file->entries[bestIndex].nameOffset), 
+                bestIndex);
+    }
+
+    return bestIndex;
+}
+
+
+// FNV-1a, only used for the in-memory name index tables
+static uint32_t hashBytes(const char *bytes, size_t length)
+{
+    uint32_t hash = 2166136261u;
+    for (size_t i = 0; i < length; i++) {
+        hash ^= (uint8_t) bytes[i];
+        hash *= 16777619u;
+    }
+    return hash;
+}
+
+static int reserveArray(void **array, uint32_t *capacity, size_t needed, 
+        size_t itemSize)
+{
+    if (needed <= *capacity) return 1;
+    if (needed > UINT32_MAX / 2) return 0;
+
+    uint32_t newCapacity = *capacity ? *capacity : 256;
+    while (newCapacity < needed) newCapacity *= 2;
+
+    void *grown = realloc(*array, (size_t) newCapacity * itemSize);
+    if (grown == NULL) return 0;
+
+    *array = grown;
+    *capacity = newCapacity;
+    return 1;
+}
+
+static char *lowercaseCopy(const char *value)
+{
+    char *copy = strdup(value);
+    if (copy == NULL) return NULL;
+
+    for (char *c = copy; *c; c++) *c = tolower((unsigned char) *c);
+    return copy;
+}
+
+static uint32_t nameIndexFindToken(LaunchTargetNameIndex *index, 
+        const char *bytes, size_t length)
+{
+    uint32_t mask = index->nTokenSlots - 1;
+    uint32_t slot = hashBytes(bytes, length) & mask;
+
+    while (index->tokenSlots[slot] != 0) {
+        uint32_t token = index->tokenSlots[slot] - 1;
+        char *tokenText = &index->text[index->tokenOffsets[token]];
+        if (memcmp(tokenText, bytes, length) == 0 
+                && tokenText[length] == '\0') 
+        {
+            return token;
+        }
+        slot = (slot + 1) & mask;
+    }
+
+    return UINT32_MAX;
+}
+
+static uint32_t nameIndexFindGram(LaunchTargetNameIndex *index, 
+        const char *bytes, size_t length)
+{
+    uint32_t mask = index->nGramSlots - 1;
+    uint32_t slot = hashBytes(bytes, length) & mask;
+
+    while (index->gramSlots[slot] != 0) {
+        uint32_t gram = index->gramSlots[slot] - 1;
+        if (index->gramLengths[gram] == length 
+                && memcmp(&index->text[index->gramOffsets[gram]], 
+                    bytes, length) == 0) 
+        {
+            return gram;
+        }
+        slot = (slot + 1) & mask;
+    }
+
+    return UINT32_MAX;
+}
+
+// Rebuilds a slot table at twice the size once it gets half full
+static int growNameIndexSlots(LaunchTargetNameIndex *index, int grams)
+{
+    uint32_t *nSlots = grams ? &index->nGramSlots : &index->nTokenSlots;
+    uint32_t **slots = grams ? &index->gramSlots : &index->tokenSlots;
+    uint32_t nItems = grams ? index->nGrams : index->nTokens;
+
+    if (*nSlots != 0 && (size_t) (nItems + 1) * 2 <= *nSlots) return 1;
+
+    uint32_t newSize = *nSlots ? *nSlots * 2 : 4096;
+    uint32_t *newSlots = calloc(newSize, sizeof(uint32_t));
+    if (newSlots == NULL) return 0;
+
+    for (uint32_t i = 0; i < nItems; i++) {
+        char *bytes = &index->text[grams 
+            ? index->gramOffsets[i] : index->tokenOffsets[i]];
+        size_t length = grams ? index->gramLengths[i] : strlen(bytes);
+        uint32_t slot = hashBytes(bytes, length) & (newSize - 1);
+
+        while (newSlots[slot] != 0) slot = (slot + 1) & (newSize - 1);
+        newSlots[slot] = i + 1;
+    }
+
+    free(*slots);
+    *slots = newSlots;
+    *nSlots = newSize;
+
+    return 1;
+}
+
+LaunchTargetNameIndex *newLaunchTargetNameIndex(LaunchTargetDb *db, 
+        char *platform)
+{
+    LaunchTargetFile *file = (LaunchTargetFile*) db->targets.memory;
+    LaunchTargetNameIndex *index = calloc(1, sizeof(LaunchTargetNameIndex));
+    if (index == NULL) return NULL;
+
+    index->db = db;
+    index->platformId = launchTargetDictLookup(db, platform);
+
+    for (uint32_t i = 0; i < file->nEntries; i++) {
+        if (launchTargetMatchable(&file->entries[i], index->platformId)) {
+            index->nEntries++;
+        }
+    }
+
+    uint32_t textCapacity = 0;
+    uint32_t entryTokenCapacity = 0;
+    uint32_t tokenCapacity = 0;
+    uint32_t gramCapacity = 0;
+    uint32_t *lastSeen = NULL;
+    uint32_t lastSeenCapacity = 0;
+
+    index->targetIndexes = calloc(index->nEntries + 1, sizeof(uint32_t));
+    index->nameOffsets = calloc(index->nEntries + 1, sizeof(uint32_t));
+    index->entryTokenStarts = calloc(index->nEntries + 1, sizeof(uint32_t));
+
+    if (index->targetIndexes == NULL || index->nameOffsets == NULL
+            || index->entryTokenStarts == NULL
+            || !growNameIndexSlots(index, 0) 
+            || !growNameIndexSlots(index, 1))
+    {
+        goto failed;
+    }
+
+    // Names, tokens and grams all live in the one text buffer, tokens 
+    // are NUL terminated and grams point into the tokens
+    uint32_t entry = 0;
+    uint32_t nEntryTokens = 0;
+    for (uint32_t i = 0; i < file->nEntries; i++) {
+        if (!launchTargetMatchable(&file->entries[i], index->platformId)) {
+            continue;
+        }
+
+        char *name = lowercaseCopy(
+                launchTargetString(db, file->entries[i].nameOffset));
+        if (name == NULL) goto failed;
+
+        size_t nameLength = strlen(name);
+        if (!reserveArray((void**) &index->text, &textCapacity, 
+                    (size_t) index->textLength + nameLength + 1, 1)) 
+        {
+            free(name);
+            goto failed;
+        }
+
+        index->targetIndexes[entry] = i;
+        index->nameOffsets[entry] = index->textLength;
+        memcpy(&index->text[index->textLength], name, nameLength + 1);
+        index->textLength += nameLength + 1;
+        index->entryTokenStarts[entry] = nEntryTokens;
+
+        char *saveptr;
+        char *token = strtok_r(name, " ", &saveptr);
+        while (token != NULL) {
+            size_t length = strlen(token);
+            uint32_t tokenId = nameIndexFindToken(index, token, length);
+
+            if (tokenId == UINT32_MAX) {
+                if (!growNameIndexSlots(index, 0)
+                        || !reserveArray((void**) &index->tokenOffsets, 
+                            &tokenCapacity, index->nTokens + 1, 
+                            sizeof(uint32_t))
+                        || !reserveArray((void**) &index->text, 
+                            &textCapacity, 
+                            (size_t) index->textLength + length + 1, 1)) 
+                {
+                    free(name);
+                    goto failed;
+                }
+
+                tokenId = index->nTokens++;
+                index->tokenOffsets[tokenId] = index->textLength;
+                memcpy(&index->text[index->textLength], token, length + 1);
+                index->textLength += length + 1;
+
+                uint32_t slot = hashBytes(token, length) 
+                    & (index->nTokenSlots - 1);
+                while (index->tokenSlots[slot] != 0) {
+                    slot = (slot + 1) & (index->nTokenSlots - 1);
+                }
+                index->tokenSlots[slot] = tokenId + 1;
+            }
+
+            if (!reserveArray((void**) &index->entryTokens, 
+                        &entryTokenCapacity, nEntryTokens + 1, 
+                        sizeof(uint32_t))) 
+            {
+                free(name);
+                goto failed;
+            }
+            index->entryTokens[nEntryTokens++] = tokenId;
+
+            token = strtok_r(NULL, " ", &saveptr);
+        }
+
+        free(name);
+        entry++;
+    }
+    index->entryTokenStarts[index->nEntries] = nEntryTokens;
+
+    // Token -> entries, counted then filled so each list stays ascending
+    index->tokenPostingStarts = calloc(index->nTokens + 1, sizeof(uint32_t));
+    if (index->tokenPostingStarts == NULL
+            || !reserveArray((void**) &lastSeen, &lastSeenCapacity, 
+                index->nTokens + 1, sizeof(uint32_t)))
+    {
+        goto failed;
+    }
+
+    for (int pass = 0; pass < 2; pass++) {
+        memset(lastSeen, 0xff, (index->nTokens + 1) * sizeof(uint32_t));
+
+        for (uint32_t e = 0; e < index->nEntries; e++) {
+            for (uint32_t t = index->entryTokenStarts[e]; 
+                    t < index->entryTokenStarts[e + 1]; t++) 
+            {
+                uint32_t tokenId = index->entryTokens[t];
+                if (lastSeen[tokenId] == e) continue;
+                lastSeen[tokenId] = e;
+
+                if (pass == 0) {
+                    index->tokenPostingStarts[tokenId + 1]++;
+                }
+                else {
+                    index->tokenPostings[
+                        index->tokenPostingStarts[tokenId]++] = e;
+                }
+            }
+        }
+
+        if (pass == 0) {
+            for (uint32_t t = 0; t < index->nTokens; t++) {
+                index->tokenPostingStarts[t + 1] += 
+                    index->tokenPostingStarts[t];
+            }
+            index->tokenPostings = malloc(
+                    (index->tokenPostingStarts[index->nTokens] + 1) 
+                        * sizeof(uint32_t));
+            if (index->tokenPostings == NULL) goto failed;
+        }
+        else {
+            // Filling advanced every start to the next one, shift back
+            for (uint32_t t = index->nTokens; t > 0; t--) {
+                index->tokenPostingStarts[t] = 
+                    index->tokenPostingStarts[t - 1];
+            }
+            index->tokenPostingStarts[0] = 0;
+        }
+    }
+
+    // Every substring of every token up to GRAM_MAX bytes. A search token
+    // that's a substring of a name token always shares its leading gram
+    for (uint32_t t = 0; t < index->nTokens; t++) {
+        uint32_t offset = index->tokenOffsets[t];
+        size_t length = strlen(&index->text[offset]);
+
+        for (size_t start = 0; start < length; start++) {
+            for (size_t gramLength = 1; gramLength <= length - start 
+                    && gramLength <= LAUNCH_TARGET_NAME_GRAM_MAX; 
+                    gramLength++) 
+            {
+                char *bytes = &index->text[offset + start];
+                if (nameIndexFindGram(index, bytes, gramLength) 
+                        != UINT32_MAX) 
+                {
+                    continue;
+                }
+
+                uint32_t previousCapacity = gramCapacity;
+                if (!growNameIndexSlots(index, 1)
+                        || !reserveArray((void**) &index->gramOffsets, 
+                            &gramCapacity, index->nGrams + 1, 
+                            sizeof(uint32_t)))
+                {
+                    goto failed;
+                }
+                if (gramCapacity != previousCapacity) {
+                    uint8_t *lengths = realloc(index->gramLengths, 
+                            gramCapacity);
+                    if (lengths == NULL) goto failed;
+                    index->gramLengths = lengths;
+                }
+
+                uint32_t gramId = index->nGrams++;
+                index->gramOffsets[gramId] = offset + start;
+                index->gramLengths[gramId] = gramLength;
+
+                uint32_t slot = hashBytes(bytes, gramLength) 
+                    & (index->nGramSlots - 1);
+                while (index->gramSlots[slot] != 0) {
+                    slot = (slot + 1) & (index->nGramSlots - 1);
+                }
+                index->gramSlots[slot] = gramId + 1;
+            }
+        }
+    }
+
+    // Gram -> tokens, same two pass approach as the token postings
+    index->gramPostingStarts = calloc(index->nGrams + 1, sizeof(uint32_t));
+    if (index->gramPostingStarts == NULL
+            || !reserveArray((void**) &lastSeen, &lastSeenCapacity, 
+                index->nGrams + 1, sizeof(uint32_t)))
+    {
+        goto failed;
+    }
+
+    for (int pass = 0; pass < 2; pass++) {
+        memset(lastSeen, 0xff, (index->nGrams + 1) * sizeof(uint32_t));
+
+        for (uint32_t t = 0; t < index->nTokens; t++) {
+            char *tokenText = &index->text[index->tokenOffsets[t]];
+            size_t length = strlen(tokenText);
+
+            for (size_t start = 0; start < length; start++) {
+                for (size_t gramLength = 1; gramLength <= length - start 
+                        && gramLength <= LAUNCH_TARGET_NAME_GRAM_MAX; 
+                        gramLength++) 
+                {
+                    uint32_t gramId = nameIndexFindGram(index, 
+                            &tokenText[start], gramLength);
+                    if (lastSeen[gramId] == t) continue;
+                    lastSeen[gramId] = t;
+
+                    if (pass == 0) {
+                        index->gramPostingStarts[gramId + 1]++;
+                    }
+                    else {
+                        index->gramPostings[
+                            index->gramPostingStarts[gramId]++] = t;
+                    }
+                }
+            }
+        }
+
+        if (pass == 0) {
+            for (uint32_t g = 0; g < index->nGrams; g++) {
+                index->gramPostingStarts[g + 1] += 
+                    index->gramPostingStarts[g];
+            }
+            index->gramPostings = malloc(
+                    (index->gramPostingStarts[index->nGrams] + 1) 
+                        * sizeof(uint32_t));
+            if (index->gramPostings == NULL) goto failed;
+        }
+        else {
+            for (uint32_t g = index->nGrams; g > 0; g--) {
+                index->gramPostingStarts[g] = 
+                    index->gramPostingStarts[g - 1];
+            }
+            index->gramPostingStarts[0] = 0;
+        }
+    }
+
+    free(lastSeen);
+
+    printf("name index for %s: %u targets, %u tokens, %u grams\n", 
+            platform, index->nEntries, index->nTokens, index->nGrams);
+
+    return index;
+
+failed:
+    printf("couldn't build the name index for %s\n", platform);
+    free(lastSeen);
+    freeLaunchTargetNameIndex(index);
+    return NULL;
+}
+
+void freeLaunchTargetNameIndex(LaunchTargetNameIndex *index)
+{
+    if (index == NULL) return;
+
+    free(index->targetIndexes);
+    free(index->nameOffsets);
+    free(index->entryTokenStarts);
+    free(index->entryTokens);
+    free(index->tokenOffsets);
+    free(index->tokenPostingStarts);
+    free(index->tokenPostings);
+    free(index->tokenSlots);
+    free(index->gramOffsets);
+    free(index->gramLengths);
+    free(index->gramPostingStarts);
+    free(index->gramPostings);
+    free(index->gramSlots);
+    free(index->text);
+    free(index);
+}
+
+static void addNameIndexCandidates(LaunchTargetNameIndex *index, 
+        uint32_t tokenId, uint8_t *seen, uint32_t *candidates, 
+        uint32_t *nCandidates)
+{
+    for (uint32_t p = index->tokenPostingStarts[tokenId]; 
+            p < index->tokenPostingStarts[tokenId + 1]; p++) 
+    {
+        uint32_t entry = index->tokenPostings[p];
+        if (seen[entry]) continue;
+        seen[entry] = 1;
+        candidates[(*nCandidates)++] = entry;
+    }
+}
+
+static int compareEntries(const void *a, const void *b)
+{
+    uint32_t left = *(const uint32_t*) a;
+    uint32_t right = *(const uint32_t*) b;
+    return (left > right) - (left < right);
+}
+
+// Same scoring as launchTargetIndexByNameMatch, but only the targets that 
+// share at least one token substring with the search get scored. Anything
+// else would have matched zero tokens there and could never win.
+int32_t launchTargetNameIndexMatch(LaunchTargetNameIndex *index, 
+        char *searchString, float *matchScore)
+{
+    printf("\nLooking for: %s\n--------------\n", searchString);
+
+    char *search = lowercaseCopy(searchString);
+    char *workingCopy = lowercaseCopy(searchString);
+    char **searchTokens = calloc(strlen(searchString) / 2 + 1, 
+            sizeof(char*));
+    uint8_t *seen = calloc(index->nEntries + 1, 1);
+    uint32_t *candidates = calloc(index->nEntries + 1, sizeof(uint32_t));
+
+    int32_t bestIndex = -1;
+    float bestScore = 0;
+
+    if (search == NULL || workingCopy == NULL || searchTokens == NULL 
+            || seen == NULL || candidates == NULL) 
+    {
+        printf("couldn't allocate name match buffers\n");
+        goto done;
+    }
+
+    uint32_t nSearchTokens = 0;
+    uint32_t nCandidates = 0;
+    char *saveptr;
+    char *token = strtok_r(workingCopy, " ", &saveptr);
+    while (token != NULL) {
+        searchTokens[nSearchTokens++] = token;
+        token = strtok_r(NULL, " ", &saveptr);
+    }
+
+    for (uint32_t s = 0; s < nSearchTokens; s++) {
+        char *searchToken = searchTokens[s];
+        size_t length = strlen(searchToken);
+
+        // Name tokens containing the search token
+        size_t gramLength = length < LAUNCH_TARGET_NAME_GRAM_MAX 
+            ? length : LAUNCH_TARGET_NAME_GRAM_MAX;
+        uint32_t gramId = nameIndexFindGram(index, searchToken, gramLength);
+
+        if (gramId != UINT32_MAX) {
+            for (uint32_t p = index->gramPostingStarts[gramId];
+                    p < index->gramPostingStarts[gramId + 1]; p++) 
+            {
+                uint32_t tokenId = index->gramPostings[p];
+                if (length > gramLength && strstr(
+                            &index->text[index->tokenOffsets[tokenId]], 
+                            searchToken) == NULL) 
+                {
+                    continue;
+                }
+                addNameIndexCandidates(index, tokenId, seen, 
+                        candidates, &nCandidates);
+            }
+        }
+
+        // Name tokens contained in the search token
+        for (size_t start = 0; start < length; start++) {
+            for (size_t end = start + 1; end <= length; end++) {
+                uint32_t tokenId = nameIndexFindToken(index, 
+                        &searchToken[start], end - start);
+                if (tokenId != UINT32_MAX) {
+                    addNameIndexCandidates(index, tokenId, seen, 
+                            candidates, &nCandidates);
+                }
+            }
+        }
+    }
+
+    // Ties go to the first target in the file, as with the full scan
+    qsort(candidates, nCandidates, sizeof(uint32_t), compareEntries);
+
+    for (uint32_t c = 0; c < nCandidates; c++) {
+        uint32_t entry = candidates[c];
+        char *entryName = &index->text[index->nameOffsets[entry]];
+        uint32_t tokensMatched = 0;
+        uint32_t numTokens = nSearchTokens 
+            + index->entryTokenStarts[entry + 1] 
+            - index->entryTokenStarts[entry];
+
+        for (uint32_t s = 0; s < nSearchTokens; s++) {
+            if (strstr(entryName, searchTokens[s]) != NULL) tokensMatched++;
+        }
+
+        for (uint32_t t = index->entryTokenStarts[entry]; 
+                t < index->entryTokenStarts[entry + 1]; t++) 
+        {
+            char *entryToken = 
+                &index->text[index->tokenOffsets[index->entryTokens[t]]];
+            if (strstr(search, entryToken) != NULL) tokensMatched++;
+        }
+
+        if (tokensMatched >= 1) {
+            float score = (float)tokensMatched/numTokens;
+            if (score > bestScore) {
+                bestScore = score;
+                *matchScore = bestScore;
+                bestIndex = index->targetIndexes[entry];
+            }
+        }
+    }
+
+done:
+    if (bestIndex == -1) {
+        printf("NOT FOUND\n\n");
+    }
+    else {
+        LaunchTargetFile *file = 
+            (LaunchTargetFile*) index->db->targets.memory;
+        printf("best match: %s - index %u\n\n",
+                launchTargetString(index->db, 
+                    file->entries[bestIndex].nameOffset), 
+                bestIndex);
+    }
+
+    free(search);
+    free(workingCopy);
+    free(searchTokens);
+    free(seen);
+    free(candidates);
+
+    return bestIndex;
+}
+
+
+// nameIndex is optional, title matches fall back to a full scan without it
+int32_t launchTargetIndexByFieldMatch(LaunchTargetDb *db, 
+        LaunchTargetNameIndex *nameIndex, char *fieldName, 
+        char *searchValue, char *platform, float *matchScore)
+{
+    if (strcmp(fieldName, "title_id") == 0) {
+        // Match against ID field in database (exact match)
+        int32_t result = launchTargetIndexByIdMatch(db, searchValue, 
+                platform);
+        if (result > -1 && matchScore != NULL) {
+            *matchScore = 1.0;  // ID matches are exact matches
+        }
+        return result;
+    }
+    else if (strcmp(fieldName, "title") == 0) {
+        // Match against title/name field (default behavior)
+        if (nameIndex != NULL) {
+            return launchTargetNameIndexMatch(nameIndex, searchValue, 
+                    matchScore);
+        }
+        return launchTargetIndexByNameMatch(db, searchValue, platform, 
+                matchScore);
+    }
+    else {
+        // Unknown field type - fall back to title matching with warning
+        printf("WARNING: Unknown match_field '%s', falling back to title matching\n",
+                fieldName);
+        if (nameIndex != NULL) {
+            return launchTargetNameIndexMatch(nameIndex, searchValue, 
+                    matchScore);
+        }
+        return launchTargetIndexByNameMatch(db, searchValue, platform, 
+                matchScore);
+    }
+}
+
+// The tokenizer only ever stops on commas, quotes and line breaks. They
+// are found 64 bytes at a time as bitmasks, with SSE2 or AVX2 where the
+// CPU has them, and fields are walked from one set bit to the next. 
+// Quotes get a mask of their own so quoted text, commas and all, is 
+// crossed a block at a time.
+#define CSV_BLOCK_SIZE 64
+
+#if __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+// One bit per byte of word that equals c, eight bytes at a time
+static uint64_t csvBytesEqual(uint64_t word, char c)
+{
+    uint64_t x = word ^ (0x0101010101010101ull * (uint8_t) c);
+    uint64_t zero = ~(((x & 0x7f7f7f7f7f7f7f7full) + 0x7f7f7f7f7f7f7f7full) 
+            | x) & 0x8080808080808080ull;
+    return ((zero >> 7) * 0x0102040810204080ull) >> 56;
+}
+
+static void csvClassifyScalar(const char *block, uint64_t *quotes, 
+        uint64_t *delimiters)
+{
+    *quotes = 0;
+    *delimiters = 0;
+    for (uint32_t i = 0; i < CSV_BLOCK_SIZE / 8; ++i) {
+        uint64_t word;
+        memcpy(&word, block + i * 8, 8);
+        *quotes |= csvBytesEqual(word, '"') << (i * 8);
+        *delimiters |= (csvBytesEqual(word, ',') | csvBytesEqual(word, '\r')
+                | csvBytesEqual(word, '\n')) << (i * 8);
+    }
+}
+#else
+static void csvClassifyScalar(const char *block, uint64_t *quotes, 
+        uint64_t *delimiters)
+{
+    *quotes = 0;
+    *delimiters = 0;
+    for (uint32_t i = 0; i < CSV_BLOCK_SIZE; ++i) {
+        char c = block[i];
+        if (c == '"') *quotes |= 1ull << i;
+        if (c == ',' || c == '\r' || c == '\n') *delimiters |= 1ull << i;
+    }
+}
+#endif
+
+#if defined(__x86_64__) || defined(__i386__)
+__attribute__((target("sse2")))
+static void csvClassifySse2(const char *block, uint64_t *quotes, 
+        uint64_t *delimiters)
+{
+    const __m128i comma = _mm_set1_epi8(',');
+    const __m128i quote = _mm_set1_epi8('"');
+    const __m128i cr = _mm_set1_epi8('\r');
+    const __m128i lf = _mm_set1_epi8('\n');
+    *quotes = 0;
+    *delimiters = 0;
+
+    for (uint32_t i = 0; i < CSV_BLOCK_SIZE / 16; ++i) {
+        __m128i bytes = _mm_loadu_si128((const __m128i*) (block + i * 16));
+        __m128i quoteHits = _mm_cmpeq_epi8(bytes, quote);
+        __m128i delimiterHits = _mm_or_si128(_mm_cmpeq_epi8(bytes, comma),
+                _mm_or_si128(_mm_cmpeq_epi8(bytes, cr), 
+                    _mm_cmpeq_epi8(bytes, lf)));
+        *quotes |= (uint64_t) (uint16_t) _mm_movemask_epi8(quoteHits) 
+            << (i * 16);
+        *delimiters |= (uint64_t) (uint16_t) _mm_movemask_epi8(delimiterHits) 
+            << (i * 16);
+    }
+}
+
+__attribute__((target("avx2")))
+static void csvClassifyAvx2(const char *block, uint64_t *quotes, 
+        uint64_t *delimiters)
+{
+    const __m256i comma = _mm256_set1_epi8(',');
+    const __m256i quote = _mm256_set1_epi8('"');
+    const __m256i cr = _mm256_set1_epi8('\r');
+    const __m256i lf = _mm256_set1_epi8('\n');
+    *quotes = 0;
+    *delimiters = 0;
+
+    for (uint32_t i = 0; i < CSV_BLOCK_SIZE / 32; ++i) {
+        __m256i bytes = _mm256_loadu_si256((const __m256i*) (block + i * 32));
+        __m256i quoteHits = _mm256_cmpeq_epi8(bytes, quote);
+        __m256i delimiterHits = _mm256_or_si256(
+                _mm256_cmpeq_epi8(bytes, comma),
+                _mm256_or_si256(_mm256_cmpeq_epi8(bytes, cr), 
+                    _mm256_cmpeq_epi8(bytes, lf)));
+        *quotes |= (uint64_t) (uint32_t) _mm256_movemask_epi8(quoteHits) 
+            << (i * 32);
+        *delimiters |= 
+            (uint64_t) (uint32_t) _mm256_movemask_epi8(delimiterHits) 
+            << (i * 32);
+    }
+}
+#endif
+
+static void (*csvClassifyBlock)(const char *block, uint64_t *quotes,
+        uint64_t *delimiters) = csvClassifyScalar;
+static pthread_once_t csvClassifyOnce = PTHREAD_ONCE_INIT;
+
+static void chooseCsvClassifier()
+{
+#if defined(__x86_64__) || defined(__i386__)
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx2")) {
+        csvClassifyBlock = csvClassifyAvx2;
+    }
+    else if (__builtin_cpu_supports("sse2")) {
+        csvClassifyBlock = csvClassifySse2;
+    }
+#endif
+}
+
+static void loadCsvBlock(CsvReader *reader, size_t blockStart)
+{
+    if (blockStart + CSV_BLOCK_SIZE <= reader->size) {
+        csvClassifyBlock(reader->memory + blockStart, 
+                &reader->quoteMask, &reader->delimiterMask);
+    }
+    else {
+        // The tail is padded with NULs, which are never structural
+        char tail[CSV_BLOCK_SIZE] = {0};
+        memcpy(tail, reader->memory + blockStart, reader->size - blockStart);
+        csvClassifyBlock(tail, &reader->quoteMask, &reader->delimiterMask);
+    }
+    reader->blockStart = blockStart;
+    reader->blockLoaded = 1;
+}
+
+// Offset of the first quote at or after from when quotes is set, 
+// otherwise of the first comma or line break, or the file size
+static size_t nextCsvStructural(CsvReader *reader, size_t from, int quotes)
+{
+    while (from < reader->size) {
+        size_t blockStart = from - (from % CSV_BLOCK_SIZE);
+
+        if (!reader->blockLoaded || reader->blockStart != blockStart) {
+            loadCsvBlock(reader, blockStart);
+        }
+
+        uint64_t mask = quotes ? reader->quoteMask : reader->delimiterMask;
+        uint64_t pending = mask >> (from - blockStart);
+        if (pending) {
+            return from + __builtin_ctzll(pending);
+        }
+        from = blockStart + CSV_BLOCK_SIZE;
+    }
+
+    return reader->size;
+}
+
+// Maps a CSV read only, the tokenizer hands out views into this mapping
+int openCsvReader(const char *path, CsvReader *reader)
+{
+    pthread_once(&csvClassifyOnce, chooseCsvClassifier);
+    *reader = (CsvReader){0};
+
+    int fd = open(path, O_RDONLY);
+    if (fd == -1) {
+        printf("couldn't open csv %s\n", path);
+        return 0;
+    }
+
+    struct stat sb;
+    if (fstat(fd, &sb) == -1) {
+        printf("couldn't stat csv %s\n", path);
+        close(fd);
+        return 0;
+    }
+
+    // An empty file is a valid CSV without any rows
+    if (sb.st_size > 0) {
+        reader->memory = mmap(NULL, sb.st_size, PROT_READ, MAP_PRIVATE, 
+                fd, 0);
+
+        if (reader->memory == MAP_FAILED) {
+            printf("couldn't map csv %s\n", path);
+            reader->memory = NULL;
+            close(fd);
+            return 0;
+        }
+
+        madvise(reader->memory, sb.st_size, MADV_SEQUENTIAL);
+        reader->size = sb.st_size;
+    }
+
+    close(fd);
+    return 1;
+}
+
+void closeCsvReader(CsvReader *reader)
+{
+    if (reader->memory) {
+        munmap(reader->memory, reader->size);
+    }
+    *reader = (CsvReader){0};
+}
+
+// Tokenizes the next row in one pass. Up to maxFields views are written
+// to fields, missing ones are left empty, and the number of fields the
+// row actually had is returned, 0 once the file is exhausted. Quoted 
+// fields may hold commas, doubled quotes and line breaks.
+uint32_t nextCsvRow(CsvReader *reader, CsvField *fields, uint32_t maxFields)
+{
+    if (reader->cursor >= reader->size) return 0;
+
+    const char *memory = reader->memory;
+    size_t cursor = reader->cursor;
+    size_t end = reader->size;
+    uint32_t nFields = 0;
+
+    while (1) {
+        CsvField field = {memory + cursor, 0, 0};
+        int quoted = cursor < end && memory[cursor] == '"';
+
+        if (quoted) {
+            cursor++;
+            field.data = memory + cursor;
+
+            // Commas and line breaks inside the quotes are just text
+            while ((cursor = nextCsvStructural(reader, cursor, 1)) < end) {
+                if (cursor + 1 < end && memory[cursor + 1] == '"') {
+                    field.nEscapes++;
+                    cursor += 2;
+                }
+                else {
+                    break;
+                }
+            }
+
+            field.length = (memory + cursor) - field.data;
+            if (cursor < end) cursor++;
+        }
+
+        // Quotes in the middle of an unquoted field are just text, anything
+        // stray after a closing quote is dropped
+        cursor = nextCsvStructural(reader, cursor, 0);
+        if (!quoted) {
+            field.length = (memory + cursor) - field.data;
+        }
+
+        if (nFields < maxFields) fields[nFields] = field;
+        nFields++;
+
+        if (cursor < end && memory[cursor] == ',') {
+            cursor++;
+            continue;
+        }
+        break;
+    }
+
+    if (cursor < end && memory[cursor] == '\r') cursor++;
+    if (cursor < end && memory[cursor] == '\n') cursor++;
+
+    for (uint32_t i = nFields; i < maxFields; ++i) {
+        fields[i] = (CsvField){"", 0, 0};
+    }
+
+    reader->cursor = cursor;
+    reader->row++;
+
+    return nFields;
+}
+
+uint32_t csvFieldLength(const CsvField *field)
+{
+    return field->length - field->nEscapes;
+}
+
+// Writes the field unescaped and NUL terminated, destination needs room 
+// for csvFieldLength + 1 bytes
+char *csvFieldCopy(const CsvField *field, char *destination)
+{
+    if (field->nEscapes == 0) {
+        memcpy(destination, field->data, field->length);
+        destination[field->length] = '\0';
+        return destination;
+    }
+
+    char *out = destination;
+    for (uint32_t i = 0; i < field->length; ++i) {
+        *out++ = field->data[i];
+        if (field->data[i] == '"') i++;
+    }
+    *out = '\0';
+
+    return destination;
+}
+
+// Reads the next row of an OpenGameDB CSV. The short columns are copied
+// out into row->buffer, which is reused from row to row, the description
+// stays a view into the file.
+uint32_t readOpenGameDbRow(CsvReader *reader, OpenGameDbRow *row)
+{
+    CsvField fields[OPENGAMEDB_NUM_COLUMNS];
+    size_t rowStart = reader->cursor;
+    if (nextCsvRow(reader, fields, OPENGAMEDB_NUM_COLUMNS) == 0) return 0;
+
+    // The line ending isn't part of the row's content
+    size_t rowEnd = reader->cursor;
+    while (rowEnd > rowStart && (reader->memory[rowEnd - 1] == '\n' 
+                || reader->memory[rowEnd - 1] == '\r')) 
+    {
+        rowEnd--;
+    }
+
+    uint64_t rowHash[2] = {0, 0};
+    lmmh_x64_128(reader->memory + rowStart, rowEnd - rowStart, 33, rowHash);
+    row->rowHash = rowHash[0] ? rowHash[0] : 1;
+
+    uint32_t columns[] = {
+        OPENGAMEDB_COLUMN_NAME, OPENGAMEDB_COLUMN_DATE, 
+        OPENGAMEDB_COLUMN_SCORE, OPENGAMEDB_COLUMN_METASCORE, 
+        OPENGAMEDB_COLUMN_COVER_URL, OPENGAMEDB_COLUMN_ID
+    };
+    char **values[] = {
+        &row->name, &row->date, &row->score, &row->metaScore, 
+        &row->coverUrl, &row->id
+    };
+    uint32_t nColumns = sizeof(columns) / sizeof(columns[0]);
+
+    size_t bytesNeeded = 0;
+    for (uint32_t i = 0; i < nColumns; ++i) {
+        bytesNeeded += csvFieldLength(&fields[columns[i]]) + 1;
+    }
+
+    if (bytesNeeded > row->bufferSize) {
+        char *buffer = realloc(row->buffer, bytesNeeded);
+        if (!buffer) {
+            printf("couldn't allocate room for csv row %u\n", reader->row);
+            return 0;
+        }
+        row->buffer = buffer;
+        row->bufferSize = bytesNeeded;
+    }
+
+    char *cursor = row->buffer;
+    for (uint32_t i = 0; i < nColumns; ++i) {
+        *values[i] = csvFieldCopy(&fields[columns[i]], cursor);
+        cursor += csvFieldLength(&fields[columns[i]]) + 1;
+    }
+
+    row->description = fields[OPENGAMEDB_COLUMN_DESCRIPTION];
+
+    return 1;
+}
+
+// GameFAQs scores are out of 5 and Metacritic's out of 100, where there's
+// both they're averaged. 999 marks a game without a valid score.
+uint32_t openGameDbRanking(const char *scoreString, 
+        const char *metaScoreString) 
+{
+    float score = -1;
+    if (strlen(scoreString) != 0) {
+        float gfScore = atof(scoreString);
+        // Validate: must be numeric and in valid range
+        if (gfScore > 0 && gfScore <= 5.0) {
+            score = gfScore * 2 * 10;
+        }
+    }
+    if (strlen(metaScoreString) != 0) {
+        float metaScore = atof(metaScoreString);
+        // Validate: must be numeric and in valid range
+        if (metaScore > 0 && metaScore <= 100) {
+            if (score == -1) {
+                score = metaScore;
+            }
+            else {
+                score = (score + metaScore) / 2;
+            }
+        }
+    }
+
+    if (score == -1) return 999;
+    return (uint32_t)round(score);
+}
+
+static uint32_t stageOpenGameDbString(OpenGameDbStage *stage, 
+        const char *value)
+{
+    size_t length = strlen(value) + 1;
+
+    if (stage->stringsUsed + length > stage->stringsCapacity) {
+        size_t capacity = 
+            stage->stringsCapacity ? stage->stringsCapacity : 65536;
+        while (stage->stringsUsed + length > capacity) capacity *= 2;
+
+        if (capacity > UINT32_MAX) return UINT32_MAX;
+
+        char *strings = realloc(stage->strings, capacity);
+        if (!strings) return UINT32_MAX;
+
+        stage->strings = strings;
+        stage->stringsCapacity = capacity;
+    }
+
+    uint32_t offset = stage->stringsUsed;
+    memcpy(&stage->strings[offset], value, length);
+    stage->stringsUsed += length;
+
+    return offset;
+}
+
+uint64_t openGameDbCsvMtime(struct stat *sb)
+{
+    return (uint64_t) sb->st_mtim.tv_sec * 1000000000ull 
+        + sb->st_mtim.tv_nsec;
+}
+
+static OpenGameDbPackPlatform *findOpenGameDbPackPlatform(
+        OpenGameDbPack *pack, const char *platform)
+{
+    if (pack == NULL || pack->memory == NULL) return NULL;
+
+    for (uint32_t i = 0; i < pack->header->nPlatforms; ++i) {
+        if (strcmp(pack->platforms[i].platform, platform) == 0) {
+            return &pack->platforms[i];
+        }
+    }
+    return NULL;
+}
+
+// Points the stage at a platform's section of the pack, nothing but the 
+// target list is copied
+static int stageFromOpenGameDbPack(OpenGameDbStage *stage, 
+        OpenGameDbPack *pack, OpenGameDbPackPlatform *packed)
+{
+    char *strings = pack->memory + packed->stringsOffset;
+    uint64_t stringsSize = packed->stringsSize;
+
+    // Every offset into a block that ends in a NUL is a valid string
+    if (stringsSize == 0 || strings[stringsSize - 1] != '\0') return 0;
+
+    OpenGameDbPackTarget *packedTargets = 
+        (OpenGameDbPackTarget*) (pack->memory + packed->targetsOffset);
+    StagedTarget *targets = 
+        calloc(packed->nTargets ? packed->nTargets : 1, sizeof(StagedTarget));
+    if (!targets) return 0;
+
+    for (uint32_t i = 0; i < packed->nTargets; ++i) {
+        OpenGameDbPackTarget *packedTarget = &packedTargets[i];
+
+        if (packedTarget->nameOffset >= stringsSize
+                || packedTarget->coverUrlOffset >= stringsSize
+                || packedTarget->idOffset >= stringsSize
+                || (uint64_t) packedTarget->descriptionOffset 
+                    + packedTarget->descriptionLength >= stringsSize)
+        {
+            free(targets);
+            return 0;
+        }
+
+        targets[i].targetSignature = packedTarget->targetSignature;
+        targets[i].rowHash = packedTarget->rowHash;
+        targets[i].ranking = packedTarget->ranking;
+        targets[i].nameOffset = packedTarget->nameOffset;
+        targets[i].coverUrlOffset = packedTarget->coverUrlOffset;
+        targets[i].idOffset = packedTarget->idOffset;
+        memcpy(targets[i].date, packedTarget->date, sizeof(targets[i].date));
+        targets[i].description.data = 
+            &strings[packedTarget->descriptionOffset];
+        targets[i].description.length = packedTarget->descriptionLength;
+    }
+
+    stage->targets = targets;
+    stage->nTargets = packed->nTargets;
+    stage->targetCapacity = packed->nTargets;
+    stage->strings = strings;
+    stage->stringsUsed = stringsSize;
+    stage->fromPack = 1;
+
+    return 1;
+}
+
+typedef struct StagedSignature {
+    uint64_t targetSignature;
+    uint32_t index;
+} StagedSignature;
+
+static int compareStagedSignatures(const void *a, const void *b)
+{
+    const StagedSignature *left = a;
+    const StagedSignature *right = b;
+    if (left->targetSignature != right->targetSignature) {
+        return left->targetSignature < right->targetSignature ? -1 : 1;
+    }
+    return left->index < right->index ? -1 : left->index > right->index;
+}
+
+// Keeps the first of any rows that share a signature, so a merge can 
+// append the new targets in one batch without looking for its own
+static int dropDuplicateStagedTargets(OpenGameDbStage *stage)
+{
+    if (stage->nTargets < 2) return 1;
+
+    StagedSignature *signatures = 
+        malloc(stage->nTargets * sizeof(StagedSignature));
+    uint8_t *duplicate = calloc(stage->nTargets, sizeof(uint8_t));
+    if (!signatures || !duplicate) {
+        free(signatures);
+        free(duplicate);
+        return 0;
+    }
+
+    for (uint32_t i = 0; i < stage->nTargets; ++i) {
+        signatures[i].targetSignature = stage->targets[i].targetSignature;
+        signatures[i].index = i;
+    }
+    qsort(signatures, stage->nTargets, sizeof(StagedSignature), 
+            compareStagedSignatures);
+
+    for (uint32_t i = 1; i < stage->nTargets; ++i) {
+        if (signatures[i].targetSignature 
+                == signatures[i - 1].targetSignature) 
+        {
+            duplicate[signatures[i].index] = 1;
+        }
+    }
+
+    uint32_t nKept = 0;
+    for (uint32_t i = 0; i < stage->nTargets; ++i) {
+        if (!duplicate[i]) stage->targets[nKept++] = stage->targets[i];
+    }
+    stage->nTargets = nKept;
+
+    free(signatures);
+    free(duplicate);
+    return 1;
+}
+
+// Stages one platform, from the pack when its section was built from a
+// CSV with the same size and content hash, otherwise by parsing the CSV. 
+// Touches nothing shared but rowsParsed, so platforms can be staged 
+// concurrently.
+int stageOpenGameDbPlatform(const char *openGameDbPath, 
+        OpenGameDbStage *stage, OpenGameDbPack *pack, uint32_t *rowsParsed)
+{
+    char *csvPath;
+    asprintf(&csvPath, "%s/%s.csv", openGameDbPath, stage->platform);
+
+    struct stat sb;
+    if (stat(csvPath, &sb) == -1 || !openCsvReader(csvPath, &stage->reader)) {
+        printf("looks like theres no opengamedb for %s\n", stage->platform);
+        free(csvPath);
+        stage->failed = 1;
+        return 0;
+    }
+    free(csvPath);
+    stage->csvMtime = openGameDbCsvMtime(&sb);
+
+    // lmmh takes an int length, CSVs that big never come from the pack
+    int hashed = stage->reader.size <= INT_MAX;
+    stage->csvSize = stage->reader.size;
+    if (hashed) {
+        lmmh_x64_128(stage->reader.memory ? stage->reader.memory : "", 
+                stage->reader.size, 33, stage->contentHash);
+    }
+
+    OpenGameDbPackPlatform *packed = 
+        findOpenGameDbPackPlatform(pack, stage->platform);
+
+    if (hashed && packed 
+            && packed->csvSize == stage->csvSize
+            && packed->contentHash[0] == stage->contentHash[0]
+            && packed->contentHash[1] == stage->contentHash[1])
+    {
+        if (stageFromOpenGameDbPack(stage, pack, packed)) {
+            closeCsvReader(&stage->reader);
+            if (rowsParsed) {
+                __atomic_add_fetch(rowsParsed, stage->nTargets, 
+                        __ATOMIC_RELAXED);
+            }
+            return 1;
+        }
+        printf("ogdb.pack section for %s is damaged, reading the csv\n", 
+                stage->platform);
+    }
+
+    OpenGameDbRow row = {0};
+    uint32_t onRow = 0;
+
+    while (readOpenGameDbRow(&stage->reader, &row)) {
+        if (onRow++ == 0) continue; // Skip header
+
+        if (stage->nTargets == stage->targetCapacity) {
+            uint32_t capacity = 
+                stage->targetCapacity ? stage->targetCapacity * 2 : 1024;
+            StagedTarget *targets = 
+                realloc(stage->targets, capacity * sizeof(StagedTarget));
+            if (!targets) {
+                stage->failed = 1;
+                break;
+            }
+            stage->targets = targets;
+            stage->targetCapacity = capacity;
+        }
+
+        StagedTarget *staged = &stage->targets[stage->nTargets];
+        memset(staged, 0, sizeof(StagedTarget));
+
+        // Include title_id in signature if available to differentiate 
+        // regional versions
+        char *gameSeed;
+        if (strlen(row.id) > 0) {
+            asprintf(&gameSeed, "%s_%s_%s", 
+                    stage->platform, row.name, row.id);
+        } else {
+            asprintf(&gameSeed, "%s_%s", stage->platform, row.name);
+        }
+
+        uint64_t targetSignature[2] = {0, 0};
+        lmmh_x64_128(gameSeed, strlen(gameSeed), 33, targetSignature);
+        free(gameSeed);
+
+        staged->targetSignature = targetSignature[0];
+        staged->rowHash = row.rowHash;
+        staged->ranking = openGameDbRanking(row.score, row.metaScore);
+        staged->description = row.description;
+
+        // TODO harden
+        if (strlen(row.date) == 10) {
+            memcpy(&staged->date, row.date, 10);
+        }
+        if (strlen(row.date) == 4 && strtod(row.date, NULL)) {
+            memcpy(&staged->date, row.date, 4);
+        }
+
+        staged->nameOffset = stageOpenGameDbString(stage, row.name);
+        staged->coverUrlOffset = stageOpenGameDbString(stage, row.coverUrl);
+        staged->idOffset = stageOpenGameDbString(stage, row.id);
+
+        if (staged->nameOffset == UINT32_MAX 
+                || staged->coverUrlOffset == UINT32_MAX
+                || staged->idOffset == UINT32_MAX)
+        {
+            stage->failed = 1;
+            break;
+        }
+
+        stage->nTargets++;
+
+        if (rowsParsed && stage->nTargets % 256 == 0) {
+            __atomic_add_fetch(rowsParsed, 256, __ATOMIC_RELAXED);
+        }
+    }
+
+    free(row.buffer);
+
+    if (rowsParsed) {
+        __atomic_add_fetch(rowsParsed, stage->nTargets % 256, 
+                __ATOMIC_RELAXED);
+    }
+
+    if (!stage->failed && !dropDuplicateStagedTargets(stage)) {
+        stage->failed = 1;
+    }
+
+    if (stage->failed) {
+        printf("couldn't stage the opengamedb rows for %s\n", 
+                stage->platform);
+        return 0;
+    }
+
+    return 1;
+}
+
+void freeOpenGameDbStage(OpenGameDbStage *stage)
+{
+    closeCsvReader(&stage->reader);
+    free(stage->targets);
+    if (!stage->fromPack) free(stage->strings);
+
+    stage->targets = NULL;
+    stage->strings = NULL;
+    stage->nTargets = 0;
+}
+
+int mapOpenGameDbPack(const char *path, OpenGameDbPack *pack)
+{
+    *pack = (OpenGameDbPack){0};
+
+    int fd = open(path, O_RDONLY);
+    if (fd == -1) return 0;
+
+    struct stat sb;
+    if (fstat(fd, &sb) == -1 
+            || (size_t) sb.st_size < sizeof(OpenGameDbPackHeader)) 
+    {
+        close(fd);
+        return 0;
+    }
+
+    char *memory = mmap(NULL, sb.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (memory == MAP_FAILED) return 0;
+
+    OpenGameDbPackHeader *header = (OpenGameDbPackHeader*) memory;
+    uint64_t size = sb.st_size;
+    uint64_t tableEnd = sizeof(OpenGameDbPackHeader) 
+        + (uint64_t) header->nPlatforms * sizeof(OpenGameDbPackPlatform);
+
+    int valid = header->magic == OPENGAMEDB_PACK_MAGIC
+        && header->version == OPENGAMEDB_PACK_VERSION
+        && header->packSize == size
+        && tableEnd <= size;
+
+    OpenGameDbPackPlatform *platforms = 
+        (OpenGameDbPackPlatform*) (memory + sizeof(OpenGameDbPackHeader));
+
+    for (uint32_t i = 0; valid && i < header->nPlatforms; ++i) {
+        OpenGameDbPackPlatform *packed = &platforms[i];
+        valid = memchr(packed->platform, '\0', sizeof(packed->platform))
+            && packed->targetsOffset % sizeof(uint64_t) == 0
+            && packed->targetsOffset >= tableEnd
+            && packed->targetsOffset <= size
+            && packed->nTargets <= (size - packed->targetsOffset) 
+                / sizeof(OpenGameDbPackTarget)
+            && packed->stringsOffset <= size
+            && packed->stringsSize <= size - packed->stringsOffset
+            && packed->stringsSize <= UINT32_MAX;
+    }
+
+    if (!valid) {
+        printf("%s isn't a usable opengamedb pack, ignoring it\n", path);
+        munmap(memory, sb.st_size);
+        return 0;
+    }
+
+    pack->memory = memory;
+    pack->size = sb.st_size;
+    pack->header = header;
+    pack->platforms = platforms;
+
+    return 1;
+}
+
+void unmapOpenGameDbPack(OpenGameDbPack *pack)
+{
+    if (pack->memory) {
+        munmap(pack->memory, pack->size);
+    }
+    *pack = (OpenGameDbPack){0};
+}
+
+static int writePackPadding(FILE *file, uint64_t *offset)
+{
+    static const char zeroes[sizeof(uint64_t)] = {0};
+    size_t padding = (sizeof(uint64_t) - *offset % sizeof(uint64_t)) 
+        % sizeof(uint64_t);
+
+    *offset += padding;
+    return padding == 0 || fwrite(zeroes, padding, 1, file) == 1;
+}
+
+// Writes one staged platform's targets and then its string block
+static int writePackStage(FILE *file, OpenGameDbStage *stage, 
+        OpenGameDbPackPlatform *packed, uint64_t *offset)
+{
+    int ok = 1;
+
+    packed->targetsOffset = *offset;
+    packed->nTargets = stage->nTargets;
+
+    // Descriptions parsed from a CSV go after the other strings, unescaped,
+    // so the block ends at descriptionOffset either way
+    uint64_t descriptionOffset = stage->stringsUsed;
+    size_t longestDescription = 0;
+
+    for (uint32_t i = 0; ok && i < stage->nTargets; ++i) {
+        StagedTarget *staged = &stage->targets[i];
+        OpenGameDbPackTarget packedTarget = {0};
+
+        packedTarget.targetSignature = staged->targetSignature;
+        packedTarget.rowHash = staged->rowHash;
+        packedTarget.ranking = staged->ranking;
+        packedTarget.nameOffset = staged->nameOffset;
+        packedTarget.coverUrlOffset = staged->coverUrlOffset;
+        packedTarget.idOffset = staged->idOffset;
+        packedTarget.descriptionLength = csvFieldLength(&staged->description);
+        memcpy(packedTarget.date, staged->date, sizeof(packedTarget.date));
+
+        if (stage->fromPack) {
+            packedTarget.descriptionOffset = 
+                staged->description.data - stage->strings;
+        }
+        else {
+            if (descriptionOffset > UINT32_MAX) {
+                ok = 0;
+                break;
+            }
+            packedTarget.descriptionOffset = descriptionOffset;
+            descriptionOffset += packedTarget.descriptionLength + 1;
+
+            if (staged->description.length > longestDescription) {
+                longestDescription = staged->description.length;
+            }
+        }
+
+        ok = fwrite(&packedTarget, sizeof(packedTarget), 1, file) == 1;
+    }
+
+    *offset += (uint64_t) stage->nTargets * sizeof(OpenGameDbPackTarget);
+    packed->stringsOffset = *offset;
+
+    if (ok && stage->stringsUsed > 0) {
+        ok = fwrite(stage->strings, stage->stringsUsed, 1, file) == 1;
+    }
+
+    if (ok && !stage->fromPack) {
+        char *description = malloc(longestDescription + 1);
+        ok = description != NULL;
+
+        for (uint32_t i = 0; ok && i < stage->nTargets; ++i) {
+            CsvField *field = &stage->targets[i].description;
+            csvFieldCopy(field, description);
+            ok = fwrite(description, csvFieldLength(field) + 1, 1, file) == 1;
+        }
+        free(description);
+    }
+
+    // An empty block still holds the empty string
+    if (ok && descriptionOffset == 0) {
+        ok = fputc('\0', file) != EOF;
+        descriptionOffset = 1;
+    }
+
+    packed->stringsSize = descriptionOffset;
+    *offset += descriptionOffset;
+
+    return ok && writePackPadding(file, offset);
+}
+
+// Writes a pack of the staged platforms to a temporary file and renames it
+// over path. Platforms only found in the previous pack are carried over
+// untouched, so a partial import doesn't shrink it.
+int writeOpenGameDbPack(const char *path, OpenGameDbStage *stages, 
+        uint32_t nStages, OpenGameDbPack *previous)
+{
+    uint32_t nPreviousPlatforms = 
+        previous && previous->memory ? previous->header->nPlatforms : 0;
+
+    OpenGameDbPackPlatform *platforms = calloc(nStages + nPreviousPlatforms + 1,
+            sizeof(OpenGameDbPackPlatform));
+    if (!platforms) return 0;
+
+    uint32_t nPlatforms = 0;
+    for (uint32_t i = 0; i < nStages; ++i) {
+        if (!stages[i].failed) nPlatforms++;
+    }
+
+    uint8_t *carried = calloc(nPreviousPlatforms + 1, sizeof(uint8_t));
+    if (!carried) {
+        free(platforms);
+        return 0;
+    }
+
+    for (uint32_t i = 0; i < nPreviousPlatforms; ++i) {
+        carried[i] = 1;
+        for (uint32_t j = 0; j < nStages; ++j) {
+            if (!stages[j].failed && strcmp(stages[j].platform, 
+                        previous->platforms[i].platform) == 0) 
+            {
+                carried[i] = 0;
+                break;
+            }
+        }
+        nPlatforms += carried[i];
+    }
+
+    char *tempPath;
+    asprintf(&tempPath, "%s.tmp", path);
+
+    FILE *file = fopen(tempPath, "wb");
+    if (file == NULL) {
+        printf("couldn't write %s\n", tempPath);
+        free(tempPath);
+        free(platforms);
+        free(carried);
+        return 0;
+    }
+
+    uint64_t offset = sizeof(OpenGameDbPackHeader) 
+        + (uint64_t) nPlatforms * sizeof(OpenGameDbPackPlatform);
+    int ok = fseek(file, offset, SEEK_SET) == 0;
+    uint32_t onPlatform = 0;
+
+    for (uint32_t i = 0; ok && i < nStages; ++i) {
+        if (stages[i].failed) continue;
+
+        OpenGameDbPackPlatform *packed = &platforms[onPlatform++];
+        memcpy(packed->platform, stages[i].platform, sizeof(packed->platform));
+        packed->platform[sizeof(packed->platform) - 1] = '\0';
+        packed->csvSize = stages[i].csvSize;
+        packed->contentHash[0] = stages[i].contentHash[0];
+        packed->contentHash[1] = stages[i].contentHash[1];
+
+        ok = writePackStage(file, &stages[i], packed, &offset);
+    }
+
+    for (uint32_t i = 0; ok && i < nPreviousPlatforms; ++i) {
+        if (!carried[i]) continue;
+
+        OpenGameDbPackPlatform *old = &previous->platforms[i];
+        OpenGameDbPackPlatform *packed = &platforms[onPlatform++];
+        *packed = *old;
+
+        size_t targetBytes = 
+            (size_t) old->nTargets * sizeof(OpenGameDbPackTarget);
+        packed->targetsOffset = offset;
+        ok = targetBytes == 0 || fwrite(previous->memory + old->targetsOffset, 
+                targetBytes, 1, file) == 1;
+        offset += targetBytes;
+
+        packed->stringsOffset = offset;
+        ok = ok && (old->stringsSize == 0 
+                || fwrite(previous->memory + old->stringsOffset, 
+                    old->stringsSize, 1, file) == 1);
+        offset += old->stringsSize;
+
+        ok = ok && writePackPadding(file, &offset);
+    }
+
+    OpenGameDbPackHeader header = {0};
+    header.magic = OPENGAMEDB_PACK_MAGIC;
+    header.version = OPENGAMEDB_PACK_VERSION;
+    header.nPlatforms = nPlatforms;
+    header.packSize = offset;
+
+    ok = ok && fseek(file, 0, SEEK_SET) == 0
+        && fwrite(&header, sizeof(header), 1, file) == 1
+        && (nPlatforms == 0 || fwrite(platforms, 
+                    sizeof(OpenGameDbPackPlatform), nPlatforms, file) 
+                == nPlatforms);
+
+    ok = (fclose(file) == 0) && ok;
+    ok = ok && rename(tempPath, path) == 0;
+
+    if (!ok) {
+        printf("couldn't write opengamedb pack %s\n", path);
+        unlink(tempPath);
+    }
+    else {
+        printf("wrote %u platforms to %s\n", nPlatforms, path);
+    }
+
+    free(tempPath);
+    free(platforms);
+    free(carried);
+
+    return ok;
+}
+
+
+// Offset 0 of a descriptions file is supposed to mean no description, but 
+// files written before it was reserved have a real blob there. It's only 
+// taken as a description by the target it was written for.
+static OffblastBlob *descriptionBlobAt(OffblastBlobFile *file, 
+        LaunchTarget *target, off_t offset)
+{
+    if (offset < 0 
+            || (size_t) offset + sizeof(OffblastBlob) > (size_t) file->cursor) 
+    {
+        return NULL;
+    }
+
+    OffblastBlob *blob = (OffblastBlob*) &file->memory[offset];
+    size_t stored = blob->length & ~DESCRIPTION_COMPRESSED;
+    if (stored == 0 
+            || stored > (size_t) file->cursor
+            || (size_t) offset + sizeof(OffblastBlob) + stored + 1 
+                > (size_t) file->cursor) 
+    {
+        return NULL;
+    }
+
+    if (offset == 0 && blob->targetSignature != target->targetSignature) {
+        return NULL;
+    }
+
+    return blob;
+}
+
+static off_t appendDescriptionBlob(OffblastDbBatch *batch, 
+        uint64_t targetSignature, const char *content, size_t length, 
+        uint64_t flags)
+{
+    size_t blobSize = sizeof(OffblastBlob) + length + 1;
+    OffblastBlobFile *file = reserveDbBatch(batch, blobSize);
+    if (file == NULL) return -1;
+
+    off_t offset = batch->committed + batch->pending;
+    OffblastBlob *blob = (OffblastBlob*) &file->memory[offset];
+    blob->targetSignature = targetSignature;
+    blob->length = length | flags;
+    memcpy(blob->content, content, length);
+    blob->content[length] = '\0';
+
+    batch->pending += blobSize;
+    return offset;
+}
+
+// Anything shorter isn't worth the uint32 and the deflate block header
+#define DESCRIPTION_COMPRESS_MIN 64
+
+static int openDescriptionDeflater(z_stream *deflater)
+{
+    memset(deflater, 0, sizeof(z_stream));
+    return deflateInit2(deflater, Z_BEST_COMPRESSION, Z_DEFLATED, -MAX_WBITS, 
+            8, Z_DEFAULT_STRATEGY) == Z_OK;
+}
+
+// Raw deflate primed with the dictionary, the stream is reused between 
+// descriptions
+static off_t appendEncodedDescription(OffblastDbBatch *batch, 
+        z_stream *deflater, const char *dictionary, uint32_t dictionaryLength,
+        uint64_t targetSignature, const char *text, size_t length, 
+        int *compressed)
+{
+    *compressed = 0;
+    if (deflater == NULL || dictionary == NULL 
+            || length < DESCRIPTION_COMPRESS_MIN || length > UINT32_MAX) 
+    {
+        return appendDescriptionBlob(batch, targetSignature, text, length, 0);
+    }
+
+    // Only worth keeping if it comes out smaller
+    size_t capacity = length - 1;
+    char *packed = malloc(capacity);
+    if (!packed) {
+        return appendDescriptionBlob(batch, targetSignature, text, length, 0);
+    }
+
+    uint32_t rawLength = length;
+    memcpy(packed, &rawLength, sizeof(uint32_t));
+
+    int ok = deflateReset(deflater) == Z_OK
+        && deflateSetDictionary(deflater, (const Bytef*) dictionary, 
+                dictionaryLength) == Z_OK;
+
+    if (ok) {
+        deflater->next_in = (Bytef*) text;
+        deflater->avail_in = length;
+        deflater->next_out = (Bytef*) packed + sizeof(uint32_t);
+        deflater->avail_out = capacity - sizeof(uint32_t);
+        ok = deflate(deflater, Z_FINISH) == Z_STREAM_END;
+    }
+
+    off_t offset;
+    if (ok) {
+        size_t packedLength = sizeof(uint32_t) + deflater->total_out;
+        offset = appendDescriptionBlob(batch, targetSignature, packed, 
+                packedLength, DESCRIPTION_COMPRESSED);
+        *compressed = 1;
+    }
+    else {
+        offset = appendDescriptionBlob(batch, targetSignature, text, length, 0);
+    }
+
+    free(packed);
+    return offset;
+}
+
+void loadDescriptionCodec(DescriptionCodec *codec, 
+        OffblastDbFile *descriptions)
+{
+    for (uint32_t i = 0; i < DESCRIPTION_CACHE_SIZE; ++i) {
+        free(codec->cache[i].text);
+    }
+    memset(codec, 0, sizeof(DescriptionCodec));
+
+    OffblastBlobFile *file = (OffblastBlobFile*) descriptions->memory;
+    if ((size_t) file->cursor < sizeof(OffblastBlob) + 1) return;
+
+    // Files from before offset 0 was reserved have a description there
+    OffblastBlob *sentinel = (OffblastBlob*) file->memory;
+    if (sentinel->length != 0 || sentinel->targetSignature == 0) return;
+
+    uint64_t offset = sentinel->targetSignature;
+    if (offset + sizeof(OffblastBlob) > (uint64_t) file->cursor) return;
+
+    OffblastBlob *dictionary = (OffblastBlob*) &file->memory[offset];
+    if (dictionary->targetSignature != DESCRIPTION_DICTIONARY_SIGNATURE
+            || dictionary->length == 0
+            || dictionary->length > DESCRIPTION_DICTIONARY_MAX
+            || offset + sizeof(OffblastBlob) + dictionary->length 
+                > (uint64_t) file->cursor)
+    {
+        return;
+    }
+
+    codec->dictionaryOffset = offset;
+    codec->dictionaryLength = dictionary->length;
+}
+
+static const char *codecDictionary(OffblastBlobFile *file, 
+        DescriptionCodec *codec)
+{
+    if (codec->dictionaryOffset == 0) return NULL;
+    return ((OffblastBlob*) &file->memory[codec->dictionaryOffset])->content;
+}
+
+off_t appendDescription(OffblastDbBatch *batch, DescriptionCodec *codec, 
+        uint64_t targetSignature, const char *text, size_t length)
+{
+    // Resolved before the append, which can move an unreserved mapping
+    const char *dictionary = 
+        codecDictionary((OffblastBlobFile*) batch->file->memory, codec);
+
+    z_stream deflater;
+    int haveDeflater = dictionary && openDescriptionDeflater(&deflater);
+    int compressed;
+
+    off_t offset = appendEncodedDescription(batch, 
+            haveDeflater ? &deflater : NULL, dictionary, 
+            codec->dictionaryLength, targetSignature, text, length, 
+            &compressed);
+
+    if (haveDeflater) deflateEnd(&deflater);
+    return offset;
+}
+
+static char *inflateDescription(OffblastBlob *blob, const char *dictionary, 
+        uint32_t dictionaryLength)
+{
+    size_t stored = blob->length & ~DESCRIPTION_COMPRESSED;
+    if (dictionary == NULL || stored < sizeof(uint32_t)) return NULL;
+
+    uint32_t rawLength;
+    memcpy(&rawLength, blob->content, sizeof(uint32_t));
+
+    char *text = malloc((size_t) rawLength + 1);
+    if (!text) return NULL;
+
+    z_stream inflater = {0};
+    if (inflateInit2(&inflater, -MAX_WBITS) != Z_OK) {
+        free(text);
+        return NULL;
+    }
+
+    int status = inflateSetDictionary(&inflater, (const Bytef*) dictionary, 
+            dictionaryLength);
+    if (status == Z_OK) {
+        inflater.next_in = (Bytef*) blob->content + sizeof(uint32_t);
+        inflater.avail_in = stored - sizeof(uint32_t);
+        inflater.next_out = (Bytef*) text;
+        inflater.avail_out = rawLength;
+        status = inflate(&inflater, Z_FINISH);
+    }
+
+    int ok = status == Z_STREAM_END && inflater.total_out == rawLength;
+    inflateEnd(&inflater);
+
+    if (!ok) {
+        printf("couldn't inflate a description\n");
+        free(text);
+        return NULL;
+    }
+
+    text[rawLength] = '\0';
+    return text;
+}
+
+char *decodeDescription(OffblastDbFile *descriptions, DescriptionCodec *codec,
+        LaunchTarget *target, off_t offset)
+{
+    OffblastBlobFile *file = (OffblastBlobFile*) descriptions->memory;
+    OffblastBlob *blob = descriptionBlobAt(file, target, offset);
+    if (blob == NULL) return NULL;
+
+    if (blob->length & DESCRIPTION_COMPRESSED) {
+        return inflateDescription(blob, codecDictionary(file, codec), 
+                codec->dictionaryLength);
+    }
+
+    return strndup(blob->content, blob->length);
+}
+
+const char *descriptionText(OffblastDbFile *descriptions, 
+        DescriptionCodec *codec, LaunchTarget *target, off_t offset)
+{
+    OffblastBlobFile *file = (OffblastBlobFile*) descriptions->memory;
+    OffblastBlob *blob = descriptionBlobAt(file, target, offset);
+    if (blob == NULL) return "";
+
+    // Plain ones are read straight out of the mapping
+    if (!(blob->length & DESCRIPTION_COMPRESSED)) return blob->content;
+
+    codec->tick++;
+
+    DescriptionCacheEntry *victim = &codec->cache[0];
+    for (uint32_t i = 0; i < DESCRIPTION_CACHE_SIZE; ++i) {
+        DescriptionCacheEntry *entry = &codec->cache[i];
+        if (entry->text && entry->offset == offset) {
+            entry->lastUsed = codec->tick;
+            return entry->text;
+        }
+
+        if (victim->text && (entry->text == NULL 
+                    || entry->lastUsed < victim->lastUsed)) 
+        {
+            victim = entry;
+        }
+    }
+
+    char *text = inflateDescription(blob, codecDictionary(file, codec), 
+            codec->dictionaryLength);
+    if (text == NULL) return "";
+
+    free(victim->text);
+    victim->offset = offset;
+    victim->lastUsed = codec->tick;
+    victim->text = text;
+
+    return text;
+}
+
+int initDescriptionDb(char *path, OffblastDbFile *descriptions, 
+        LaunchTargetDb *db)
+{
+    recoverDescriptionCompaction(path, db);
+
+    if (!InitDbFile(path, descriptions, 1)) return 0;
+
+    // New files start with an empty blob so that offset 0 is never 
+    // anyone's description
+    OffblastBlobFile *file = (OffblastBlobFile*) descriptions->memory;
+    if (file->cursor == 0) {
+        OffblastDbBatch batch;
+        beginDbBatch(&batch, descriptions, 1, OFFBLAST_DB_TYPE_BLOB);
+        if (appendDescriptionBlob(&batch, 0, "", 0, 0) == -1 
+                || !commitDbBatch(&batch)) 
+        {
+            return 0;
+        }
+    }
+
+    return 1;
+}
+
+typedef struct DescriptionSlot {
+    uint64_t hash[2];
+    size_t length;
+    off_t offset;     // 0 is the empty blob, never stored here
+} DescriptionSlot;
+
+// Finds the text's slot, or the empty one it would go in
+static DescriptionSlot *findDescriptionSlot(DescriptionSlot *slots, 
+        uint64_t mask, const char *text, size_t length)
+{
+    uint64_t hash[2] = {0, 0};
+    lmmh_x64_128(text, length, 33, hash);
+
+    uint64_t slot = hash[0] & mask;
+    while (slots[slot].offset != 0) {
+        if (slots[slot].hash[0] == hash[0] && slots[slot].hash[1] == hash[1]
+                && slots[slot].length == length) 
+        {
+            return &slots[slot];
+        }
+        slot = (slot + 1) & mask;
+    }
+
+    slots[slot].hash[0] = hash[0];
+    slots[slot].hash[1] = hash[1];
+    slots[slot].length = length;
+    return &slots[slot];
+}
+
+// What the descriptions would take up once compacted. Blobs are counted 
+// once per distinct stored content, as compaction keeps one copy of each 
+// text however many targets or appends share it.
+size_t liveDescriptionBytes(OffblastDbFile *descriptions, LaunchTargetDb *db)
+{
+    LaunchTargetFile *targets = (LaunchTargetFile*) db->targets.memory;
+    LaunchTargetColdFile *cold = (LaunchTargetColdFile*) db->cold.memory;
+    OffblastBlobFile *file = (OffblastBlobFile*) descriptions->memory;
+    uint32_t nEntries = cold->nEntries < targets->nEntries 
+        ? cold->nEntries : targets->nEntries;
+
+    uint64_t nSlots = 1024;
+    while (nSlots < (uint64_t) nEntries * 2) nSlots <<= 1;
+    DescriptionSlot *slots = calloc(nSlots, sizeof(DescriptionSlot));
+    if (!slots) return file->cursor;
+
+    size_t live = 0;
+    for (uint32_t i = 0; i < nEntries; ++i) {
+        off_t offset = cold->entries[i].descriptionOffset;
+        OffblastBlob *blob = 
+            descriptionBlobAt(file, &targets->entries[i], offset);
+        if (blob == NULL) continue;
+
+        // Compared as stored, a text kept both compressed and not is 
+        // counted twice
+        size_t stored = blob->length & ~DESCRIPTION_COMPRESSED;
+        DescriptionSlot *slot = findDescriptionSlot(slots, nSlots - 1, 
+                blob->content, stored);
+        if (slot->offset != 0) continue;
+        slot->offset = offset ? offset : 1;
+
+        live += sizeof(OffblastBlob) + stored + 1;
+    }
+
+    free(slots);
+    return live;
+}
+
+// Every target's new description offset, written and synced before the 
+// compacted file replaces the old one. If it's still there on startup 
+// the swap didn't finish and is finished from it.
+#define DESCRIPTION_REMAP_MAGIC 0x50524344
+
+typedef struct DescriptionRemapHeader {
+    uint32_t magic;
+    uint32_t nEntries;
+} DescriptionRemapHeader;
+
+static int applyDescriptionRemap(LaunchTargetDb *db, off_t *offsets, 
+        uint32_t nEntries)
+{
+    LaunchTargetColdFile *cold = (LaunchTargetColdFile*) db->cold.memory;
+    if (nEntries > cold->nEntries) return 0;
+
+    for (uint32_t i = 0; i < nEntries; ++i) {
+        cold->entries[i].descriptionOffset = offsets[i];
+    }
+
+    return msync(db->cold.memory, db->cold.nBytesAllocated, MS_SYNC) == 0;
+}
+
+int recoverDescriptionCompaction(char *path, LaunchTargetDb *db)
+{
+    char *compactedPath;
+    char *remapPath;
+    asprintf(&compactedPath, "%s.compacting", path);
+    asprintf(&remapPath, "%s.remap", path);
+
+    int ok = 1;
+    FILE *remap = fopen(remapPath, "rb");
+
+    if (remap) {
+        DescriptionRemapHeader header;
+        off_t *offsets = NULL;
+
+        // A remap that's short never got as far as the swap
+        int complete = fread(&header, sizeof(header), 1, remap) == 1
+            && header.magic == DESCRIPTION_REMAP_MAGIC
+            && (offsets = malloc((header.nEntries + 1) * sizeof(off_t)))
+            && fread(offsets, sizeof(off_t), header.nEntries, remap) 
+                == header.nEntries;
+        fclose(remap);
+
+        if (complete) {
+            printf("finishing an interrupted description compaction\n");
+            if (access(compactedPath, F_OK) == 0 
+                    && rename(compactedPath, path) == -1) 
+            {
+                perror("couldn't swap in the compacted descriptions\n");
+                ok = 0;
+            }
+            else if (!applyDescriptionRemap(db, offsets, header.nEntries)) {
+                printf("couldn't patch the description offsets\n");
+                ok = 0;
+            }
+        }
+        free(offsets);
+
+        if (ok) unlink(remapPath);
+    }
+
+    // Whatever is left was never swapped in
+    if (ok) unlink(compactedPath);
+
+    free(compactedPath);
+    free(remapPath);
+    return ok;
+}
+
+static int writeDescriptionRemap(const char *remapPath, off_t *offsets, 
+        uint32_t nEntries)
+{
+    FILE *remap = fopen(remapPath, "wb");
+    if (!remap) return 0;
+
+    DescriptionRemapHeader header = {DESCRIPTION_REMAP_MAGIC, nEntries};
+    int ok = fwrite(&header, sizeof(header), 1, remap) == 1
+        && fwrite(offsets, sizeof(off_t), nEntries, remap) == nEntries
+        && fflush(remap) == 0
+        && fsync(fileno(remap)) == 0;
+
+    ok = (fclose(remap) == 0) && ok;
+    if (!ok) unlink(remapPath);
+
+    return ok;
+}
+
+// Dictionary training keeps the 64 byte stretches of the sample whose 8 
+// byte substrings turn up in the most descriptions, a cut down COVER
+#define DICTIONARY_KMER 8
+#define DICTIONARY_SEGMENT 64
+#define DICTIONARY_STEP 16
+#define DICTIONARY_KMER_BITS 20
+#define DESCRIPTION_SAMPLE_BYTES (4 << 20)
+
+typedef struct DictionarySegment {
+    uint32_t score;
+    uint32_t sample;
+    uint32_t start;
+} DictionarySegment;
+
+static uint32_t dictionaryKmer(const char *at)
+{
+    uint64_t kmer;
+    memcpy(&kmer, at, DICTIONARY_KMER);
+    return (kmer * 0x9E3779B97F4A7C15ull) >> (64 - DICTIONARY_KMER_BITS);
+}
+
+static uint32_t scoreSegment(const char *segment, uint32_t *frequency)
+{
+    uint32_t score = 0;
+    for (uint32_t i = 0; i + DICTIONARY_KMER <= DICTIONARY_SEGMENT; ++i) {
+        score += frequency[dictionaryKmer(&segment[i])];
+    }
+    return score;
+}
+
+static void siftSegmentDown(DictionarySegment *heap, uint32_t nHeap, 
+        uint32_t i)
+{
+    while (1) {
+        uint32_t largest = i;
+        uint32_t left = 2 * i + 1;
+        uint32_t right = left + 1;
+        if (left < nHeap && heap[left].score > heap[largest].score) {
+            largest = left;
+        }
+        if (right < nHeap && heap[right].score > heap[largest].score) {
+            largest = right;
+        }
+        if (largest == i) return;
+
+        DictionarySegment swap = heap[i];
+        heap[i] = heap[largest];
+        heap[largest] = swap;
+        i = largest;
+    }
+}
+
+// Returns the dictionary's length, 0 if the samples had nothing in common.
+// The best segments go last where deflate reaches them with the shortest 
+// distances.
+static uint32_t trainDescriptionDictionary(char **samples, size_t *lengths, 
+        uint32_t nSamples, char *dictionary, uint32_t capacity)
+{
+    uint32_t nKmers = 1u << DICTIONARY_KMER_BITS;
+    uint32_t *frequency = calloc(nKmers, sizeof(uint32_t));
+    uint32_t *seenIn = calloc(nKmers, sizeof(uint32_t));
+
+    uint32_t nSegments = 0;
+    for (uint32_t s = 0; s < nSamples; ++s) {
+        if (lengths[s] >= DICTIONARY_SEGMENT) {
+            nSegments += (lengths[s] - DICTIONARY_SEGMENT) / DICTIONARY_STEP 
+                + 1;
+        }
+    }
+
+    uint32_t maxChosen = capacity / DICTIONARY_SEGMENT;
+    DictionarySegment *heap = malloc((nSegments + 1) 
+            * sizeof(DictionarySegment));
+    DictionarySegment *chosen = malloc((maxChosen + 1) 
+            * sizeof(DictionarySegment));
+
+    if (!frequency || !seenIn || !heap || !chosen) {
+        free(frequency);
+        free(seenIn);
+        free(heap);
+        free(chosen);
+        return 0;
+    }
+
+    // How many descriptions each kmer is in, not how often
+    for (uint32_t s = 0; s < nSamples; ++s) {
+        for (size_t i = 0; i + DICTIONARY_KMER <= lengths[s]; ++i) {
+            uint32_t kmer = dictionaryKmer(&samples[s][i]);
+            if (seenIn[kmer] != s + 1) {
+                seenIn[kmer] = s + 1;
+                frequency[kmer]++;
+            }
+        }
+    }
+
+    // A kmer only in one description is no use to any other
+    for (uint32_t i = 0; i < nKmers; ++i) {
+        if (frequency[i] < 2) frequency[i] = 0;
+    }
+
+    uint32_t nHeap = 0;
+    for (uint32_t s = 0; s < nSamples; ++s) {
+        for (size_t start = 0; start + DICTIONARY_SEGMENT <= lengths[s]; 
+                start += DICTIONARY_STEP) 
+        {
+            DictionarySegment *segment = &heap[nHeap++];
+            segment->sample = s;
+            segment->start = start;
+            segment->score = scoreSegment(&samples[s][start], frequency);
+        }
+    }
+
+    for (uint32_t i = nHeap / 2; i-- > 0;) {
+        siftSegmentDown(heap, nHeap, i);
+    }
+
+    // Scores only fall as kmers get covered, so a stale top is rescored 
+    // and sifted until the top is current
+    uint32_t nChosen = 0;
+    while (nHeap > 0 && nChosen < maxChosen) {
+        DictionarySegment *top = &heap[0];
+        const char *segment = &samples[top->sample][top->start];
+        uint32_t score = scoreSegment(segment, frequency);
+
+        if (score < top->score) {
+            top->score = score;
+            siftSegmentDown(heap, nHeap, 0);
+            continue;
+        }
+        if (score == 0) break;
+
+        chosen[nChosen++] = *top;
+        for (uint32_t i = 0; i + DICTIONARY_KMER <= DICTIONARY_SEGMENT; ++i) {
+            frequency[dictionaryKmer(&segment[i])] = 0;
+        }
+
+        heap[0] = heap[--nHeap];
+        siftSegmentDown(heap, nHeap, 0);
+    }
+
+    uint32_t length = 0;
+    for (uint32_t i = nChosen; i-- > 0;) {
+        memcpy(&dictionary[length], 
+                &samples[chosen[i].sample][chosen[i].start], 
+                DICTIONARY_SEGMENT);
+        length += DICTIONARY_SEGMENT;
+    }
+
+    free(frequency);
+    free(seenIn);
+    free(heap);
+    free(chosen);
+
+    return length;
+}
+
+// Trains a dictionary on a sample of the distinct live descriptions
+static uint32_t sampleDescriptionDictionary(OffblastDbFile *descriptions, 
+        DescriptionCodec *codec, LaunchTargetDb *db, uint32_t nEntries,
+        DescriptionSlot *slots, uint64_t mask, char *dictionary)
+{
+    LaunchTargetFile *targets = (LaunchTargetFile*) db->targets.memory;
+    LaunchTargetColdFile *cold = (LaunchTargetColdFile*) db->cold.memory;
+
+    char **samples = malloc((nEntries + 1) * sizeof(char*));
+    size_t *lengths = malloc((nEntries + 1) * sizeof(size_t));
+    uint32_t nSamples = 0;
+    size_t sampled = 0;
+
+    for (uint32_t i = 0; samples && lengths && i < nEntries 
+            && sampled < DESCRIPTION_SAMPLE_BYTES; ++i) 
+    {
+        char *text = decodeDescription(descriptions, codec, 
+                &targets->entries[i], cold->entries[i].descriptionOffset);
+        if (text == NULL) continue;
+
+        size_t length = strlen(text);
+        DescriptionSlot *slot = findDescriptionSlot(slots, mask, text, length);
+        if (slot->offset != 0 || length < DICTIONARY_SEGMENT) {
+            free(text);
+            continue;
+        }
+
+        slot->offset = 1;
+        samples[nSamples] = text;
+        lengths[nSamples++] = length;
+        sampled += length;
+    }
+
+    uint32_t length = 0;
+    if (samples && lengths) {
+        length = trainDescriptionDictionary(samples, lengths, nSamples, 
+                dictionary, DESCRIPTION_DICTIONARY_MAX);
+    }
+
+    for (uint32_t i = 0; i < nSamples; ++i) free(samples[i]);
+    free(samples);
+    free(lengths);
+
+    return length;
+}
+
+// Rewrites the live descriptions contiguously into a new file, storing 
+// each distinct text once and compressed against a dictionary trained on 
+// them, then swaps it in and points every target at its new offset. 
+// Offset 0 of the result is always the empty blob. On failure the old 
+// file and offsets are left as they were.
+int compactDescriptionDb(char *path, OffblastDbFile *descriptions, 
+        DescriptionCodec *codec, LaunchTargetDb *db, 
+        DescriptionCompactionStats *stats)
+{
+    LaunchTargetFile *targets = (LaunchTargetFile*) db->targets.memory;
+    LaunchTargetColdFile *cold = (LaunchTargetColdFile*) db->cold.memory;
+    OffblastBlobFile *oldFile = (OffblastBlobFile*) descriptions->memory;
+    uint32_t nEntries = cold->nEntries < targets->nEntries 
+        ? cold->nEntries : targets->nEntries;
+
+    uint64_t nSlots = 1024;
+    while (nSlots < (uint64_t) nEntries * 2) nSlots <<= 1;
+    uint64_t mask = nSlots - 1;
+
+    off_t *offsets = calloc(cold->nEntries + 1, sizeof(off_t));
+    DescriptionSlot *slots = calloc(nSlots, sizeof(DescriptionSlot));
+    char *dictionary = malloc(DESCRIPTION_DICTIONARY_MAX);
+
+    char *compactedPath;
+    char *remapPath;
+    asprintf(&compactedPath, "%s.compacting", path);
+    asprintf(&remapPath, "%s.remap", path);
+    unlink(compactedPath);
+
+    memset(stats, 0, sizeof(DescriptionCompactionStats));
+    stats->bytesBefore = oldFile->cursor;
+
+    OffblastDbFile newDb = {0};
+    OffblastDbBatch batch;
+    z_stream deflater;
+    int haveDeflater = 0;
+    int ok = offsets && slots && dictionary 
+        && InitDbFile(compactedPath, &newDb, 1);
+
+    if (ok) {
+        stats->dictionaryLength = sampleDescriptionDictionary(descriptions, 
+                codec, db, nEntries, slots, mask, dictionary);
+        memset(slots, 0, nSlots * sizeof(DescriptionSlot));
+
+        beginDbBatch(&batch, &newDb, 1, OFFBLAST_DB_TYPE_BLOB);
+        ok = appendDescriptionBlob(&batch, 0, "", 0, 0) == 0;
+    }
+
+    if (ok && stats->dictionaryLength > 0) {
+        off_t dictionaryOffset = appendDescriptionBlob(&batch, 
+                DESCRIPTION_DICTIONARY_SIGNATURE, dictionary, 
+                stats->dictionaryLength, 0);
+        haveDeflater = dictionaryOffset != -1 
+            && openDescriptionDeflater(&deflater);
+        ok = haveDeflater;
+
+        if (ok) {
+            OffblastBlobFile *newFile = (OffblastBlobFile*) newDb.memory;
+            ((OffblastBlob*) newFile->memory)->targetSignature = 
+                dictionaryOffset;
+        }
+    }
+
+    for (uint32_t i = 0; ok && i < nEntries; ++i) {
+        LaunchTarget *target = &targets->entries[i];
+        char *text = decodeDescription(descriptions, codec, target, 
+                cold->entries[i].descriptionOffset);
+        if (text == NULL) continue;
+
+        size_t length = strlen(text);
+        DescriptionSlot *slot = findDescriptionSlot(slots, mask, text, length);
+
+        if (slot->offset != 0) {
+            offsets[i] = slot->offset;
+            stats->nShared++;
+            free(text);
+            continue;
+        }
+
+        int compressed;
+        off_t offset = appendEncodedDescription(&batch, 
+                haveDeflater ? &deflater : NULL, dictionary, 
+                stats->dictionaryLength, target->targetSignature, 
+                text, length, &compressed);
+        free(text);
+
+        if (offset == -1) {
+            ok = 0;
+            break;
+        }
+
+        slot->offset = offset;
+        offsets[i] = offset;
+        stats->nStored++;
+        stats->nCompressed += compressed;
+    }
+
+    if (haveDeflater) deflateEnd(&deflater);
+
+    // Room for a while of appends but no more
+    if (ok) {
+        ok = commitDbBatch(&batch);
+        size_t used = sizeof(OffblastBlobFile) 
+            + ((OffblastBlobFile*) newDb.memory)->cursor;
+        if (ok && used + BLOB_GROW_SIZE < newDb.nBytesAllocated) {
+            ok = resizeDbFile(&newDb, used + BLOB_GROW_SIZE);
+        }
+    }
+
+    // Nothing has changed until the remap is on disk, after it a crash 
+    // is finished by recoverDescriptionCompaction
+    ok = ok && writeDescriptionRemap(remapPath, offsets, cold->nEntries);
+
+    if (ok && rename(compactedPath, path) == -1) {
+        perror("couldn't swap in the compacted descriptions\n");
+        unlink(remapPath);
+        ok = 0;
+    }
+
+    if (ok) {
+        if (applyDescriptionRemap(db, offsets, cold->nEntries)) {
+            unlink(remapPath);
+        }
+        else {
+            printf("couldn't patch the description offsets, they'll be "
+                    "patched on the next start\n");
+        }
+
+        stats->bytesAfter = ((OffblastBlobFile*) newDb.memory)->cursor;
+        closeDbFile(descriptions);
+        *descriptions = newDb;
+        loadDescriptionCodec(codec, descriptions);
+    }
+    else {
+        if (newDb.memory) closeDbFile(&newDb);
+        unlink(compactedPath);
+    }
+
+    free(offsets);
+    free(slots);
+    free(dictionary);
+    free(compactedPath);
+    free(remapPath);
+
+    return ok;
+}
+
+
+// What the string heap would take up once compacted, each distinct string 
+// counted once
+size_t liveLaunchTargetStringBytes(LaunchTargetDb *db)
+{
+    LaunchTargetFile *targets = (LaunchTargetFile*) db->targets.memory;
+    OffblastBlobFile *heap = (OffblastBlobFile*) db->strings.memory;
+
+    uint64_t nSlots = 1024;
+    while (nSlots < (uint64_t) targets->nEntries * LAUNCH_STRING_COLUMNS * 2) {
+        nSlots <<= 1;
+    }
+    DescriptionSlot *slots = calloc(nSlots, sizeof(DescriptionSlot));
+    if (!slots) return heap->cursor;
+
+    size_t live = 1;
+    uint32_t offsets[LAUNCH_STRING_COLUMNS];
+    for (uint32_t i = 0; i < targets->nEntries; ++i) {
+        launchTargetStringOffsets(db, i, offsets);
+
+        for (uint32_t column = 0; column < LAUNCH_STRING_COLUMNS; ++column) {
+            if (offsets[column] == 0) continue;
+
+            const char *value = launchTargetString(db, offsets[column]);
+            size_t length = strlen(value);
+            DescriptionSlot *slot = findDescriptionSlot(slots, nSlots - 1, 
+                    value, length);
+            if (slot->offset != 0) continue;
+            slot->offset = offsets[column];
+
+            live += length + 1;
+        }
+    }
+
+    free(slots);
+    return live;
+}
+
+// Where the string ends up in the compacted heap, it's only stored the 
+// first time it's seen
+static uint32_t compactLaunchTargetString(OffblastDbBatch *batch, 
+        DescriptionSlot *slots, uint64_t mask, const char *value, 
+        LaunchTargetStringCompactionStats *stats)
+{
+    size_t length = strlen(value);
+    if (length == 0) return 0;
+
+    DescriptionSlot *slot = findDescriptionSlot(slots, mask, value, length);
+    if (slot->offset != 0) {
+        stats->nShared++;
+        return slot->offset;
+    }
+
+    uint64_t offset = batch->committed + batch->pending;
+    if (offset + length + 1 > UINT32_MAX) return LAUNCH_TARGET_STRING_FAILED;
+
+    OffblastBlobFile *heap = reserveDbBatch(batch, length + 1);
+    if (heap == NULL) return LAUNCH_TARGET_STRING_FAILED;
+
+    memcpy(&heap->memory[offset], value, length + 1);
+    batch->pending += length + 1;
+
+    slot->offset = offset;
+    stats->nStored++;
+    return offset;
+}
+
+int compactLaunchTargetStrings(char *configPath, LaunchTargetDb *db, 
+        LaunchTargetStringCompactionStats *stats)
+{
+    LaunchTargetFile *targets = (LaunchTargetFile*) db->targets.memory;
+    OffblastBlobFile *oldHeap = (OffblastBlobFile*) db->strings.memory;
+    uint32_t nEntries = targets->nEntries;
+
+    uint64_t nSlots = 1024;
+    while (nSlots < (uint64_t) nEntries * LAUNCH_STRING_COLUMNS * 2) {
+        nSlots <<= 1;
+    }
+    uint64_t mask = nSlots - 1;
+
+    uint32_t *offsets = calloc((size_t) nEntries * LAUNCH_STRING_COLUMNS + 1,
+            sizeof(uint32_t));
+    DescriptionSlot *slots = calloc(nSlots, sizeof(DescriptionSlot));
+
+    char *stringsPath;
+    char *compactedPath;
+    char *remapPath;
+    asprintf(&stringsPath, "%s/launchstrings.bin", configPath);
+    asprintf(&compactedPath, "%s.compacting", stringsPath);
+    asprintf(&remapPath, "%s.remap", stringsPath);
+    unlink(compactedPath);
+
+    memset(stats, 0, sizeof(LaunchTargetStringCompactionStats));
+    stats->bytesBefore = oldHeap->cursor;
+
+    OffblastDbFile newDb = {0};
+    OffblastDbBatch batch;
+    int ok = offsets && slots && InitDbFile(compactedPath, &newDb, 1);
+
+    // Offset 0 is the empty string in the new heap too
+    if (ok) {
+        beginDbBatch(&batch, &newDb, 1, OFFBLAST_DB_TYPE_BLOB);
+        OffblastBlobFile *heap = reserveDbBatch(&batch, 1);
+        ok = heap != NULL;
+        if (ok) {
+            heap->memory[0] = '\0';
+            batch.pending = 1;
+        }
+    }
+
+    for (uint32_t i = 0; ok && i < nEntries; ++i) {
+        uint32_t *remapped = &offsets[(size_t) i * LAUNCH_STRING_COLUMNS];
+        launchTargetStringOffsets(db, i, remapped);
+
+        for (uint32_t column = 0; column < LAUNCH_STRING_COLUMNS; ++column) {
+            if (remapped[column] == 0) continue;
+
+            remapped[column] = compactLaunchTargetString(&batch, slots, mask,
+                    launchTargetString(db, remapped[column]), stats);
+            if (remapped[column] == LAUNCH_TARGET_STRING_FAILED) {
+                ok = 0;
+                break;
+            }
+        }
+    }
+
+    // Room for a while of appends but no more
+    if (ok) {
+        ok = commitDbBatch(&batch);
+        size_t used = sizeof(OffblastBlobFile) 
+            + ((OffblastBlobFile*) newDb.memory)->cursor;
+        if (ok && used + BLOB_GROW_SIZE < newDb.nBytesAllocated) {
+            ok = resizeDbFile(&newDb, used + BLOB_GROW_SIZE);
+        }
+    }
+
+    // Nothing has changed until the remap is on disk, after it a crash 
+    // is finished when the db is next opened
+    ok = ok && writeLaunchStringRemap(remapPath, offsets, nEntries);
+
+    if (ok && rename(compactedPath, stringsPath) == -1) {
+        perror("couldn't swap in the compacted launch target strings\n");
+        unlink(remapPath);
+        ok = 0;
+    }
+
+    if (ok) {
+        if (applyLaunchStringRemap(db, offsets, nEntries)) {
+            unlink(remapPath);
+        }
+        else {
+            printf("couldn't patch the launch target string offsets, "
+                    "they'll be patched on the next start\n");
+        }
+
+        stats->bytesAfter = ((OffblastBlobFile*) newDb.memory)->cursor;
+        closeDbFile(&db->strings);
+        db->strings = newDb;
+    }
+    else {
+        if (newDb.memory) closeDbFile(&newDb);
+        unlink(compactedPath);
+    }
+
+    free(offsets);
+    free(slots);
+    free(stringsPath);
+    free(compactedPath);
+    free(remapPath);
+
+    return ok;
+}
+
+
+// Including platforms that have been loaded back
+static LaunchTargetShard *findShardListing(LaunchTargetDb *db, 
+        const char *platform)
+{
+    LaunchTargetShardFile *shards = (LaunchTargetShardFile*) db->shards.memory;
+    if (shards == NULL) return NULL;
+
+    for (uint32_t i = 0; i < shards->nEntries; ++i) {
+        if (strcmp(shards->entries[i].platform, platform) == 0) {
+            return &shards->entries[i];
+        }
+    }
+
+    return NULL;
+}
+
+LaunchTargetShard *findLaunchTargetShard(LaunchTargetDb *db, 
+        const char *platform)
+{
+    LaunchTargetShard *shard = findShardListing(db, platform);
+    if (shard && (shard->flags & LAUNCH_TARGET_SHARD_LOADED)) return NULL;
+    return shard;
+}
+
+static void dropLaunchTargetShard(LaunchTargetDb *db, LaunchTargetShard *shard)
+{
+    LaunchTargetShardFile *shards = (LaunchTargetShardFile*) db->shards.memory;
+    *shard = shards->entries[--shards->nEntries];
+    msync(db->shards.memory, db->shards.nBytesAllocated, MS_SYNC);
+}
+
+static char *launchTargetShardPath(char *configPath, const char *platform)
+{
+    char *path;
+    asprintf(&path, "%s/shards/%s.bin", configPath, platform);
+    return path;
+}
+
+// Appends to the shard text, growing it as needed
+static int appendShardText(char **text, uint64_t *length, size_t *capacity, 
+        const char *value, size_t valueLength, uint64_t *offset)
+{
+    if (*length + valueLength + 1 > *capacity) {
+        size_t newCapacity = *capacity * 2;
+        if (newCapacity < *length + valueLength + 1) {
+            newCapacity = *length + valueLength + 1;
+        }
+
+        char *grown = realloc(*text, newCapacity);
+        if (grown == NULL) return 0;
+        *text = grown;
+        *capacity = newCapacity;
+    }
+
+    *offset = *length;
+    memcpy(&(*text)[*length], value, valueLength);
+    (*text)[*length + valueLength] = '\0';
+    *length += valueLength + 1;
+
+    return 1;
+}
+
+// Moves a string from the heap into the shard text, offset is changed 
+// from one to the other
+static int appendShardString(char **text, uint64_t *length, 
+        size_t *capacity, LaunchTargetDb *db, uint32_t *offset)
+{
+    const char *value = launchTargetString(db, *offset);
+    if (value[0] == '\0') {
+        *offset = 0;
+        return 1;
+    }
+
+    uint64_t textOffset;
+    if (*length >= UINT32_MAX - 1
+            || !appendShardText(text, length, capacity, value, 
+                strlen(value), &textOffset))
+    {
+        return 0;
+    }
+
+    *offset = textOffset;
+    return 1;
+}
+
+// Written to a temporary file and renamed over the old shard so a shard 
+// is always complete
+static int writeLaunchTargetShard(char *configPath, LaunchTargetDb *db, 
+        OpenGameDbRowStateFile *rows, OffblastDbFile *descriptions, 
+        DescriptionCodec *codec, uint16_t platformId, uint32_t nTargets)
+{
+    LaunchTargetFile *targets = (LaunchTargetFile*) db->targets.memory;
+    LaunchTargetColdFile *cold = (LaunchTargetColdFile*) db->cold.memory;
+    const char *platform = launchTargetDictValue(db, platformId);
+
+    size_t capacity = 4096;
+    LaunchTargetShardRecord *records = 
+        calloc(nTargets + 1, sizeof(LaunchTargetShardRecord));
+    char *text = malloc(capacity);
+    if (!records || !text) {
+        free(records);
+        free(text);
+        return 0;
+    }
+
+    LaunchTargetShardHeader header = {0};
+    header.magic = LAUNCH_TARGET_SHARD_MAGIC;
+    header.version = LAUNCH_TARGET_SHARD_VERSION;
+    strncpy(header.platform, platform, sizeof(header.platform) - 1);
+
+    text[0] = '\0';
+    header.textLength = 1;
+
+    // Strings and descriptions go in the shard as text, what they took up 
+    // is left for the next compaction
+    int ok = 1;
+    for (uint32_t i = 0; ok && i < targets->nEntries 
+            && header.nTargets < nTargets; ++i) 
+    {
+        LaunchTarget *target = &targets->entries[i];
+        if (target->platformId != platformId) continue;
+
+        LaunchTargetShardRecord *record = &records[header.nTargets++];
+        record->target = *target;
+        if (i < cold->nEntries) record->cold = cold->entries[i];
+        if (rows && i < rows->nEntries) {
+            record->rowHash = rows->entries[i].rowHash;
+        }
+
+        ok = appendShardString(&text, &header.textLength, &capacity, db, 
+                    &record->target.nameOffset)
+            && appendShardString(&text, &header.textLength, &capacity, db, 
+                    &record->cold.idOffset)
+            && appendShardString(&text, &header.textLength, &capacity, db, 
+                    &record->cold.pathOffset)
+            && appendShardString(&text, &header.textLength, &capacity, db, 
+                    &record->cold.coverUrlOffset);
+
+        char *description = decodeDescription(descriptions, codec, target, 
+                record->cold.descriptionOffset);
+        record->cold.descriptionOffset = 0;
+        if (description) {
+            uint64_t offset = 0;
+            record->descriptionLength = strlen(description);
+            ok = ok && appendShardText(&text, &header.textLength, &capacity,
+                    description, record->descriptionLength, &offset);
+            record->cold.descriptionOffset = offset;
+            free(description);
+        }
+    }
+
+    char *path = launchTargetShardPath(configPath, platform);
+    char *tempPath;
+    asprintf(&tempPath, "%s.tmp", path);
+
+    FILE *file = ok ? fopen(tempPath, "wb") : NULL;
+    ok = file != NULL
+        && fwrite(&header, sizeof(header), 1, file) == 1
+        && fwrite(records, sizeof(LaunchTargetShardRecord), header.nTargets, 
+                file) == header.nTargets
+        && fwrite(text, header.textLength, 1, file) == 1;
+
+    if (file) {
+        ok = ok && fflush(file) == 0 && fsync(fileno(file)) == 0;
+        ok = (fclose(file) == 0) && ok;
+    }
+    ok = ok && rename(tempPath, path) == 0;
+
+    if (!ok) {
+        printf("couldn't write launch target shard %s\n", path);
+        unlink(tempPath);
+    }
+
+    free(text);
+    free(records);
+    free(path);
+    free(tempPath);
+
+    return ok;
+}
+
+int evictLaunchTargetShards(char *configPath, LaunchTargetDb *db, 
+        OffblastDbFile *rowStates, OffblastDbFile *descriptions, 
+        DescriptionCodec *codec, const uint8_t *evict, uint32_t *nEvicted)
+{
+    LaunchTargetFile *targets = (LaunchTargetFile*) db->targets.memory;
+    LaunchTargetColdFile *cold = (LaunchTargetColdFile*) db->cold.memory;
+    OpenGameDbRowStateFile *rows = 
+        (OpenGameDbRowStateFile*) rowStates->memory;
+
+    *nEvicted = 0;
+
+    uint8_t *evicting = calloc(UINT16_MAX + 1, sizeof(uint8_t));
+    uint32_t *counts = calloc(UINT16_MAX + 1, sizeof(uint32_t));
+    if (!evicting || !counts) {
+        free(evicting);
+        free(counts);
+        return 0;
+    }
+    memcpy(evicting, evict, UINT16_MAX + 1);
+
+    // Something needed these since they were last evicted and likely will 
+    // again
+    LaunchTargetShardFile *shards = (LaunchTargetShardFile*) db->shards.memory;
+    for (uint32_t i = 0; i < shards->nEntries; ++i) {
+        if (!(shards->entries[i].flags & LAUNCH_TARGET_SHARD_LOADED)) continue;
+
+        uint16_t id = launchTargetDictLookup(db, shards->entries[i].platform);
+        if (id != LAUNCH_TARGET_DICT_MISSING) evicting[id] = 0;
+    }
+
+    for (uint32_t i = 0; i < targets->nEntries; ++i) {
+        LaunchTarget *target = &targets->entries[i];
+        if (target->launcherSignature != 0 || target->ownerId != 0
+                || (target->flags & LAUNCH_TARGET_INSTALLED)) 
+        {
+            evicting[target->platformId] = 0;
+        }
+        counts[target->platformId]++;
+    }
+
+    char *shardsPath;
+    asprintf(&shardsPath, "%s/shards", configPath);
+    if (mkdir(shardsPath, 0755) == -1 && errno != EEXIST) {
+        perror("couldn't create the launch target shards directory\n");
+        memset(evicting, 0, UINT16_MAX + 1);
+    }
+    free(shardsPath);
+
+    // Shards are written before anything is dropped, a crash in between 
+    // leaves targets in both places and loading skips the ones it has
+    int ok = 1;
+    for (uint32_t id = 0; ok && id <= UINT16_MAX; ++id) {
+        if (!evicting[id]) continue;
+
+        if (counts[id] == 0 || !writeLaunchTargetShard(configPath, db, rows, 
+                    descriptions, codec, id, counts[id])) 
+        {
+            evicting[id] = 0;
+            continue;
+        }
+
+        const char *platform = launchTargetDictValue(db, id);
+        LaunchTargetShard *shard = findShardListing(db, platform);
+        if (shard == NULL) {
+            LaunchTargetShardFile *shards = growDbFileIfNecessary(&db->shards,
+                    sizeof(LaunchTargetShard), OFFBLAST_DB_TYPE_FIXED);
+            if (shards == NULL) {
+                evicting[id] = 0;
+                ok = 0;
+                break;
+            }
+
+            shard = &shards->entries[shards->nEntries++];
+            memset(shard, 0, sizeof(LaunchTargetShard));
+            strncpy(shard->platform, platform, sizeof(shard->platform) - 1);
+        }
+        shard->nTargets = counts[id];
+    }
+
+    ok = msync(db->shards.memory, db->shards.nBytesAllocated, MS_SYNC) == 0 
+        && ok;
+
+    // The cold and row files can be short of the targets, what they do 
+    // have is a prefix and stays one
+    uint32_t nCold = cold->nEntries;
+    uint32_t nRows = rows->nEntries;
+    uint32_t kept = 0;
+    uint32_t keptCold = 0;
+    uint32_t keptRows = 0;
+
+    for (uint32_t i = 0; i < targets->nEntries; ++i) {
+        if (evicting[targets->entries[i].platformId]) continue;
+
+        if (kept != i) {
+            targets->entries[kept] = targets->entries[i];
+            if (i < nCold) cold->entries[kept] = cold->entries[i];
+            if (i < nRows) rows->entries[kept] = rows->entries[i];
+        }
+        if (i < nCold) keptCold = kept + 1;
+        if (i < nRows) keptRows = kept + 1;
+        kept++;
+    }
+
+    *nEvicted = targets->nEntries - kept;
+
+    if (*nEvicted > 0) {
+        memset(&cold->entries[keptCold], 0, 
+                (nCold - keptCold) * sizeof(LaunchTargetCold));
+        memset(&rows->entries[keptRows], 0, 
+                (nRows - keptRows) * sizeof(OpenGameDbRowState));
+        cold->nEntries = keptCold;
+        rows->nEntries = keptRows;
+        targets->nEntries = kept;
+
+        ok = msync(db->targets.memory, db->targets.nBytesAllocated, 
+                MS_SYNC) == 0 && ok;
+        ok = msync(db->cold.memory, db->cold.nBytesAllocated, MS_SYNC) == 0 
+            && ok;
+        ok = msync(rowStates->memory, rowStates->nBytesAllocated, 
+                MS_SYNC) == 0 && ok;
+
+        if (db->index.memory) rebuildLaunchTargetIndex(db);
+    }
+
+    free(evicting);
+    free(counts);
+
+    return ok;
+}
+
+static int shardStringValid(const char *text, uint64_t textLength, 
+        uint32_t offset)
+{
+    return offset < textLength 
+        && memchr(&text[offset], '\0', textLength - offset) != NULL;
+}
+
+static LaunchTargetShardHeader *readLaunchTargetShard(const char *path, 
+        const char *platform)
+{
+    FILE *file = fopen(path, "rb");
+    if (file == NULL) return NULL;
+
+    struct stat sb;
+    LaunchTargetShardHeader *header = NULL;
+    if (fstat(fileno(file), &sb) == 0 
+            && (size_t) sb.st_size >= sizeof(LaunchTargetShardHeader))
+    {
+        header = malloc(sb.st_size);
+        if (header && fread(header, sb.st_size, 1, file) != 1) {
+            free(header);
+            header = NULL;
+        }
+    }
+    fclose(file);
+    if (header == NULL) return NULL;
+
+    LaunchTargetShardRecord *records = (LaunchTargetShardRecord*) &header[1];
+    char *text = (char*) &records[header->nTargets];
+
+    int valid = header->magic == LAUNCH_TARGET_SHARD_MAGIC
+        && header->version == LAUNCH_TARGET_SHARD_VERSION
+        && strncmp(header->platform, platform, sizeof(header->platform)) == 0
+        && sizeof(LaunchTargetShardHeader) + (uint64_t) header->nTargets 
+            * sizeof(LaunchTargetShardRecord) + header->textLength 
+            == (uint64_t) sb.st_size;
+
+    for (uint32_t i = 0; valid && i < header->nTargets; ++i) {
+        valid = shardStringValid(text, header->textLength, 
+                    records[i].target.nameOffset)
+            && shardStringValid(text, header->textLength, 
+                    records[i].cold.idOffset)
+            && shardStringValid(text, header->textLength, 
+                    records[i].cold.pathOffset)
+            && shardStringValid(text, header->textLength, 
+                    records[i].cold.coverUrlOffset);
+
+        uint64_t offset = records[i].cold.descriptionOffset;
+        uint64_t length = records[i].descriptionLength;
+        if (!valid || length == 0) continue;
+
+        valid = offset < header->textLength 
+            && length < header->textLength - offset
+            && text[offset + length] == '\0';
+    }
+
+    if (!valid) {
+        free(header);
+        return NULL;
+    }
+
+    return header;
+}
+
+// Moves a string from the shard text back into the heap, offset is changed 
+// from one to the other
+static int restoreShardString(LaunchTargetDb *db, const char *text, 
+        uint64_t textLength, uint32_t *offset)
+{
+    uint32_t heapOffset = storeLaunchTargetString(db, 0, &text[*offset], 
+            textLength - *offset);
+    if (heapOffset == LAUNCH_TARGET_STRING_FAILED) return 0;
+
+    *offset = heapOffset;
+    return 1;
+}
+
+int loadLaunchTargetShard(char *configPath, LaunchTargetDb *db, 
+        OffblastDbFile *rowStates, OffblastDbFile *descriptions, 
+        DescriptionCodec *codec, const char *platform)
+{
+    LaunchTargetShard *shard = findLaunchTargetShard(db, platform);
+    if (shard == NULL) return 1;
+
+    char *path = launchTargetShardPath(configPath, platform);
+    LaunchTargetShardHeader *header = readLaunchTargetShard(path, platform);
+
+    if (header == NULL) {
+        printf("launch target shard %s is missing or damaged\n", path);
+        dropLaunchTargetShard(db, shard);
+        unlink(path);
+        free(path);
+        return 0;
+    }
+
+    LaunchTargetShardRecord *records = (LaunchTargetShardRecord*) &header[1];
+    char *text = (char*) &records[header->nTargets];
+
+    // The cold and row records are brought level with the targets so the 
+    // loaded ones line up with them
+    LaunchTargetFile *targets = (LaunchTargetFile*) db->targets.memory;
+    int ok = targets->nEntries == 0 
+        || appendLaunchTargetCold(db, 
+                &targets->entries[targets->nEntries - 1]);
+
+    OffblastDbBatch targetBatch;
+    OffblastDbBatch coldBatch;
+    OffblastDbBatch rowBatch;
+    OffblastDbBatch descriptionBatch;
+    beginDbBatch(&targetBatch, &db->targets, sizeof(LaunchTarget), 
+            OFFBLAST_DB_TYPE_FIXED);
+    beginDbBatch(&coldBatch, &db->cold, sizeof(LaunchTargetCold), 
+            OFFBLAST_DB_TYPE_FIXED);
+    beginDbBatch(&rowBatch, rowStates, sizeof(OpenGameDbRowState), 
+            OFFBLAST_DB_TYPE_FIXED);
+    beginDbBatch(&descriptionBatch, descriptions, 1, OFFBLAST_DB_TYPE_BLOB);
+
+    uint32_t nPadding = rowBatch.committed < targetBatch.committed
+        ? targetBatch.committed - rowBatch.committed : 0;
+
+    ok = ok && rowBatch.committed <= targetBatch.committed
+        && coldBatch.committed == targetBatch.committed
+        && reserveDbBatch(&targetBatch, header->nTargets)
+        && reserveDbBatch(&coldBatch, header->nTargets)
+        && reserveDbBatch(&rowBatch, nPadding + header->nTargets);
+
+    if (ok) {
+        OpenGameDbRowStateFile *rows = 
+            (OpenGameDbRowStateFile*) rowStates->memory;
+        memset(&rows->entries[rowBatch.committed], 0, 
+                nPadding * sizeof(OpenGameDbRowState));
+        rowBatch.pending = nPadding;
+    }
+
+    uint32_t nLoaded = 0;
+    for (uint32_t i = 0; ok && i < header->nTargets; ++i) {
+        LaunchTargetShardRecord *record = &records[i];
+        if (launchTargetIndexLookup(db, record->target.targetSignature) >= 0) {
+            continue;
+        }
+
+        off_t descriptionOffset = 0;
+        if (record->descriptionLength > 0) {
+            descriptionOffset = appendDescription(&descriptionBatch, codec, 
+                    record->target.targetSignature, 
+                    &text[record->cold.descriptionOffset], 
+                    record->descriptionLength);
+            if (descriptionOffset == -1) {
+                ok = 0;
+                break;
+            }
+        }
+
+        ok = restoreShardString(db, text, header->textLength, 
+                    &record->target.nameOffset)
+            && restoreShardString(db, text, header->textLength, 
+                    &record->cold.idOffset)
+            && restoreShardString(db, text, header->textLength, 
+                    &record->cold.pathOffset)
+            && restoreShardString(db, text, header->textLength, 
+                    &record->cold.coverUrlOffset);
+        if (!ok) break;
+
+        LaunchTargetFile *targetFile = 
+            (LaunchTargetFile*) db->targets.memory;
+        LaunchTargetColdFile *coldFile = 
+            (LaunchTargetColdFile*) db->cold.memory;
+        OpenGameDbRowStateFile *rows = 
+            (OpenGameDbRowStateFile*) rowStates->memory;
+
+        targetFile->entries[targetBatch.committed + targetBatch.pending++] = 
+            record->target;
+
+        LaunchTargetCold *cold = 
+            &coldFile->entries[coldBatch.committed + coldBatch.pending++];
+        *cold = record->cold;
+        cold->descriptionOffset = descriptionOffset;
+
+        rows->entries[rowBatch.committed + rowBatch.pending++].rowHash = 
+            record->rowHash;
+
+        nLoaded++;
+    }
+
+    // Targets last, so there's never one without its cold record
+    ok = ok && commitDbBatch(&descriptionBatch)
+        && commitDbBatch(&rowBatch)
+        && commitDbBatch(&coldBatch)
+        && commitLaunchTargetBatch(db, &targetBatch);
+
+    if (ok) {
+        printf("loaded %u %s targets from their shard\n", nLoaded, platform);
+        shard = findLaunchTargetShard(db, platform);
+        shard->nTargets = 0;
+        shard->flags |= LAUNCH_TARGET_SHARD_LOADED;
+        msync(db->shards.memory, db->shards.nBytesAllocated, MS_SYNC);
+        unlink(path);
+    }
+    else {
+        printf("couldn't load launch target shard %s\n", path);
+    }
+
+    free(header);
+    free(path);
+
+    return ok;
+}
+
+
+// Most recent first, then most played first, ties in file order
+static int playTimeRanksBefore(PlayTimeFile *playTimes, int mostPlayed, 
+        uint32_t a, uint32_t b)
+{
+    PlayTime *left = &playTimes->entries[a];
+    PlayTime *right = &playTimes->entries[b];
+    uint32_t leftKey = mostPlayed ? left->msPlayed : left->lastPlayed;
+    uint32_t rightKey = mostPlayed ? right->msPlayed : right->lastPlayed;
+
+    if (leftKey != rightKey) return leftKey > rightKey;
+    return a < b;
+}
+
+static uint32_t *playTimeRankSlot(PlayTimeRankFile *file, uint32_t position,
+        int mostPlayed)
+{
+    return mostPlayed 
+        ? &file->entries[position].byMsPlayed 
+        : &file->entries[position].byLastPlayed;
+}
+
+// Slides the entry at position up or down until it's in order again
+static void settlePlayTimeRank(PlayTimeRankFile *file, 
+        PlayTimeFile *playTimes, int mostPlayed, uint32_t position)
+{
+    uint32_t moving = *playTimeRankSlot(file, position, mostPlayed);
+
+    while (position > 0 && playTimeRanksBefore(playTimes, mostPlayed, 
+                moving, *playTimeRankSlot(file, position - 1, mostPlayed))) 
+    {
+        *playTimeRankSlot(file, position, mostPlayed) = 
+            *playTimeRankSlot(file, position - 1, mostPlayed);
+        position--;
+    }
+
+    while (position + 1 < file->nEntries 
+            && playTimeRanksBefore(playTimes, mostPlayed, 
+                *playTimeRankSlot(file, position + 1, mostPlayed), moving)) 
+    {
+        *playTimeRankSlot(file, position, mostPlayed) = 
+            *playTimeRankSlot(file, position + 1, mostPlayed);
+        position++;
+    }
+
+    *playTimeRankSlot(file, position, mostPlayed) = moving;
+}
+
+typedef struct PlayTimeRankOrder {
+    PlayTimeFile *playTimes;
+    int mostPlayed;
+} PlayTimeRankOrder;
+
+static int comparePlayTimeRanks(const void *a, const void *b, void *context)
+{
+    PlayTimeRankOrder *order = context;
+    uint32_t left = *(const uint32_t*) a;
+    uint32_t right = *(const uint32_t*) b;
+
+    if (left == right) return 0;
+    return playTimeRanksBefore(order->playTimes, order->mostPlayed, 
+            left, right) ? -1 : 1;
+}
+
+int rebuildPlayTimeRanks(OffblastDbFile *ranks, PlayTimeFile *playTimes)
+{
+    // The whole file is rewritten from the start
+    OffblastDbBatch batch;
+    beginDbBatch(&batch, ranks, sizeof(PlayTimeRank), OFFBLAST_DB_TYPE_FIXED);
+    batch.committed = 0;
+
+    PlayTimeRankFile *file = reserveDbBatch(&batch, playTimes->nEntries);
+    uint32_t *order = malloc((playTimes->nEntries + 1) * sizeof(uint32_t));
+    if (file == NULL || order == NULL) {
+        free(order);
+        return 0;
+    }
+
+    for (int mostPlayed = 0; mostPlayed < 2; ++mostPlayed) {
+        for (uint32_t i = 0; i < playTimes->nEntries; ++i) order[i] = i;
+
+        PlayTimeRankOrder context = {playTimes, mostPlayed};
+        qsort_r(order, playTimes->nEntries, sizeof(uint32_t), 
+                comparePlayTimeRanks, &context);
+
+        for (uint32_t i = 0; i < playTimes->nEntries; ++i) {
+            *playTimeRankSlot(file, i, mostPlayed) = order[i];
+        }
+    }
+
+    file->version = PLAY_TIME_RANK_VERSION;
+    file->nEntries = playTimes->nEntries;
+
+    free(order);
+    return 1;
+}
+
+// Each order has to hold every entry once and be sorted
+static int playTimeRanksValid(PlayTimeRankFile *file, PlayTimeFile *playTimes)
+{
+    if (file->version != PLAY_TIME_RANK_VERSION 
+            || file->nEntries != playTimes->nEntries) 
+    {
+        return 0;
+    }
+
+    uint8_t *seen = calloc(file->nEntries + 1, 2);
+    if (!seen) return 0;
+
+    int valid = 1;
+    for (uint32_t i = 0; valid && i < file->nEntries; ++i) {
+        for (int mostPlayed = 0; valid && mostPlayed < 2; ++mostPlayed) {
+            uint32_t index = *playTimeRankSlot(file, i, mostPlayed);
+
+            valid = index < file->nEntries 
+                && !seen[index * 2 + mostPlayed]
+                && (i == 0 || playTimeRanksBefore(playTimes, mostPlayed,
+                        *playTimeRankSlot(file, i - 1, mostPlayed), index));
+
+            if (valid) seen[index * 2 + mostPlayed] = 1;
+        }
+    }
+
+    free(seen);
+    return valid;
+}
+
+int initPlayTimeRanks(char *path, OffblastDbFile *ranks, 
+        PlayTimeFile *playTimes)
+{
+    if (!InitDbFile(path, ranks, sizeof(PlayTimeRank))) return 0;
+
+    PlayTimeRankFile *file = (PlayTimeRankFile*) ranks->memory;
+    if (!playTimeRanksValid(file, playTimes)) {
+        printf("play time ranks missing or stale, rebuilding\n");
+        return rebuildPlayTimeRanks(ranks, playTimes);
+    }
+
+    return 1;
+}
+
+int updatePlayTimeRank(OffblastDbFile *ranks, PlayTimeFile *playTimes, 
+        uint32_t index)
+{
+    PlayTimeRankFile *file = (PlayTimeRankFile*) ranks->memory;
+
+    if (file->version != PLAY_TIME_RANK_VERSION 
+            || file->nEntries > playTimes->nEntries
+            || index >= playTimes->nEntries) 
+    {
+        return rebuildPlayTimeRanks(ranks, playTimes);
+    }
+
+    // New entries start at the bottom and are settled like any other
+    if (file->nEntries < playTimes->nEntries) {
+        OffblastDbBatch batch;
+        beginDbBatch(&batch, ranks, sizeof(PlayTimeRank), 
+                OFFBLAST_DB_TYPE_FIXED);
+        file = reserveDbBatch(&batch, playTimes->nEntries - file->nEntries);
+        if (file == NULL) return 0;
+
+        while (file->nEntries < playTimes->nEntries) {
+            uint32_t position = file->nEntries++;
+            file->entries[position].byLastPlayed = position;
+            file->entries[position].byMsPlayed = position;
+            settlePlayTimeRank(file, playTimes, 0, position);
+            settlePlayTimeRank(file, playTimes, 1, position);
+        }
+    }
+
+    for (int mostPlayed = 0; mostPlayed < 2; ++mostPlayed) {
+        for (uint32_t i = 0; i < file->nEntries; ++i) {
+            if (*playTimeRankSlot(file, i, mostPlayed) == index) {
+                settlePlayTimeRank(file, playTimes, mostPlayed, i);
+                break;
+            }
+        }
+    }
+
+    return 1;
 }
@@ -1,5 +1,6 @@
 #include <stdint.h>
 #include <linux/limits.h>
+#include <sys/stat.h>
 
 enum OffBlastDbType {
     OFFBLAST_DB_TYPE_FIXED = 1,
@@ -11,12 +12,27 @@ typedef struct OffblastDbFileFormat {
     void *entries;
 } OffblastDbFileFormat;
 
+// memory never moves while the file grows, so pointers into it can be 
+// held across imports, unless nBytesReserved is 0 because no address space 
+// could be reserved for it
 typedef struct OffblastDbFile {
     int fd;
     size_t nBytesAllocated;
+    size_t nBytesReserved;
     OffblastDbFileFormat *memory;
 } OffblastDbFile;
 
+// Appends to a db file that are written past its header's count and only 
+// become part of it, in one header update and one flush, on commit. Fixed 
+// files count items, blob files count bytes.
+typedef struct OffblastDbBatch {
+    OffblastDbFile *file;
+    enum OffBlastDbType type;
+    size_t itemSize;
+    size_t committed;
+    size_t pending;
+} OffblastDbBatch;
+
 #define LAUNCHER_RETROARCH 1;
 #define LAUNCHER_CUSTOM 99;
 #define MAX_LAUNCH_COMMAND_LENGTH 512
@@ -47,30 +63,67 @@ typedef struct LauncherFile {
 } LauncherFile;
 
 #define OFFBLAST_NAME_MAX 256
+#define LAUNCH_TARGET_VERSION 4
+
+// LaunchTarget.flags
+#define LAUNCH_TARGET_INSTALLED 1
+#define LAUNCH_TARGET_RETIRED 2  // its row has gone from the OpenGameDB
+
+// Hot columns, everything the list builders filter and sort on. Lives in
+// launchtargets.bin
 typedef struct LaunchTarget {
     uint64_t targetSignature;
-
-    char id[OFFBLAST_NAME_MAX];
-    char name[OFFBLAST_NAME_MAX];
-    char date[10];
+    uint32_t launcherSignature;
     uint32_t ranking;
 
-    char path[PATH_MAX];
-    float matchScore;
-    char platform[256];
-    uint32_t launcherSignature;
+    // Offset into the string heap (launchstrings.bin), 0 is the empty string
+    uint32_t nameOffset;
 
-    char coverUrl[PATH_MAX];
-    off_t descriptionOffset;
+    // Ids from the dictionary (launchdictionary.bin), 0 is the empty string
+    uint16_t platformId;
+    uint16_t ownerId;  // Steam account owner, 0 for shared games (ROMs)
 
-    char ownerTag[64];  // Steam account owner, or empty for shared games (ROMs)
+    uint16_t flags;
+    char date[10];
 } LaunchTarget;
 
 typedef struct LaunchTargetFile {
     uint32_t nEntries;
+    uint32_t version;  // padding in v1 files, so it reads as 0 there
     LaunchTarget entries[];
 } LaunchTargetFile;
 
+// Cold columns, only needed to launch, scrape or describe a single target.
+// Lives in launchtargets.cold at the same index as the hot record
+typedef struct LaunchTargetCold {
+    uint32_t idOffset;
+    uint32_t pathOffset;
+    uint32_t coverUrlOffset;
+    float matchScore;
+    off_t descriptionOffset;
+} LaunchTargetCold;
+
+typedef struct LaunchTargetColdFile {
+    uint32_t nEntries;
+    LaunchTargetCold entries[];
+} LaunchTargetColdFile;
+
+// Returned by storeLaunchTargetString when the string heap couldn't take 
+// the value, the target keeps its old one
+#define LAUNCH_TARGET_STRING_FAILED UINT32_MAX
+
+// Platform and owner names, a target stores index + 1
+#define LAUNCH_TARGET_DICT_VALUE_MAX 256
+#define LAUNCH_TARGET_DICT_MISSING UINT16_MAX
+typedef struct LaunchTargetDictEntry {
+    char value[LAUNCH_TARGET_DICT_VALUE_MAX];
+} LaunchTargetDictEntry;
+
+typedef struct LaunchTargetDictFile {
+    uint32_t nEntries;
+    LaunchTargetDictEntry entries[];
+} LaunchTargetDictFile;
+
 typedef struct OffblastBlobFile {
     off_t cursor;
     char memory[];
@@ -82,6 +135,152 @@ typedef struct OffblastBlob {
     char content[];
 } OffblastBlob;
 
+// Set in OffblastBlob.length when the content is a uint32 of the text's 
+// length followed by the text deflated against the file's dictionary
+#define DESCRIPTION_COMPRESSED (1ull << 63)
+
+// The blob at offset 0 holds no description, its targetSignature is the 
+// offset of the dictionary blob, which is tagged with this
+#define DESCRIPTION_DICTIONARY_SIGNATURE 0x5452434944424f4full
+#define DESCRIPTION_DICTIONARY_MAX 32768
+
+// Must be more than the focused tile and the neighbours prefetched with it
+#define DESCRIPTION_CACHE_SIZE 8
+
+typedef struct DescriptionCacheEntry {
+    off_t offset;
+    uint32_t lastUsed;
+    char *text;
+} DescriptionCacheEntry;
+
+typedef struct DescriptionCodec {
+    off_t dictionaryOffset;    // 0 when the file has no dictionary
+    uint32_t dictionaryLength;
+    uint32_t tick;
+    DescriptionCacheEntry cache[DESCRIPTION_CACHE_SIZE];
+} DescriptionCodec;
+
+typedef struct DescriptionCompactionStats {
+    uint32_t nStored;          // distinct descriptions kept
+    uint32_t nShared;          // targets pointed at another's copy
+    uint32_t nCompressed;
+    uint32_t dictionaryLength;
+    size_t bytesBefore;
+    size_t bytesAfter;
+} DescriptionCompactionStats;
+
+typedef struct LaunchTargetStringCompactionStats {
+    uint32_t nStored;          // distinct strings kept
+    uint32_t nShared;          // fields pointed at another's copy
+    size_t bytesBefore;
+    size_t bytesAfter;
+} LaunchTargetStringCompactionStats;
+
+// Open-addressing hash index over LaunchTargetFile, keyed by targetSignature.
+// Lives in launchtargets.idx and is kept in step with the targets file.
+#define LAUNCH_TARGET_INDEX_VERSION 1
+typedef struct LaunchTargetIndexSlot {
+    uint64_t targetSignature;
+    uint32_t entryIndexPlusOne;  // 0 marks an empty slot
+    uint32_t reserved;
+} LaunchTargetIndexSlot;
+
+typedef struct LaunchTargetIndexFile {
+    uint32_t version;
+    uint32_t nIndexed;           // targets file entries covered by the index
+    uint64_t nSlots;             // always a power of two
+    uint64_t lastSignature;      // signature of entry nIndexed-1, for staleness
+    LaunchTargetIndexSlot slots[];
+} LaunchTargetIndexFile;
+
+// Platforms that nothing is configured to use have their targets moved 
+// out of the launch target files into shards/<platform>.bin, listed in 
+// launchshards.bin, and are only loaded back once something needs them.
+// Shard records keep their dictionary ids, but their strings are copied 
+// into the shard so the string heap can be compacted while they're out.
+#define LAUNCH_TARGET_SHARD_VERSION 2
+#define LAUNCH_TARGET_SHARD_MAGIC 0x44524853
+
+// Kept in the listing once a platform's shard has been loaded back, so 
+// that it isn't evicted again and rewritten on every start
+#define LAUNCH_TARGET_SHARD_LOADED 0x1
+
+typedef struct LaunchTargetShard {
+    char platform[256];
+    uint32_t nTargets;
+    uint32_t flags;
+} LaunchTargetShard;
+
+typedef struct LaunchTargetShardFile {
+    uint32_t nEntries;
+    uint32_t version;
+    LaunchTargetShard entries[];
+} LaunchTargetShardFile;
+
+// A shard is the header, nTargets records, then their strings and 
+// descriptions. The text starts with the empty string, like the heap.
+typedef struct LaunchTargetShardHeader {
+    uint32_t magic;
+    uint32_t version;
+    uint32_t nTargets;
+    uint32_t reserved;
+    uint64_t textLength;
+    char platform[256];
+} LaunchTargetShardHeader;
+
+typedef struct LaunchTargetShardRecord {
+    // The string offsets and descriptionOffset are into the shard text
+    LaunchTarget target;
+    LaunchTargetCold cold;
+    uint64_t rowHash;
+    uint64_t descriptionLength;  // 0 for none
+} LaunchTargetShardRecord;
+
+// All the files making up the launch target database, opened together by
+// InitLaunchTargetDb
+typedef struct LaunchTargetDb {
+    OffblastDbFile targets;     // LaunchTargetFile
+    OffblastDbFile cold;        // LaunchTargetColdFile
+    OffblastDbFile strings;     // OffblastBlobFile
+    OffblastDbFile dictionary;  // LaunchTargetDictFile
+    OffblastDbFile index;       // LaunchTargetIndexFile, optional
+    OffblastDbFile shards;      // LaunchTargetShardFile
+} LaunchTargetDb;
+
+// In-memory inverted index over the lowercased name tokens of one
+// platform's targets, built once per import and read-only afterwards so
+// it can be queried from several threads. Lengths are in bytes.
+#define LAUNCH_TARGET_NAME_GRAM_MAX 6
+
+typedef struct LaunchTargetNameIndex {
+    LaunchTargetDb *db;
+    uint16_t platformId;
+
+    uint32_t nEntries;
+    uint32_t *targetIndexes;     // target index of each entry, ascending
+    uint32_t *nameOffsets;       // lowercased name of each entry in text
+    uint32_t *entryTokenStarts;  // nEntries + 1, into entryTokens
+    uint32_t *entryTokens;       // token ids in name order, repeats kept
+
+    uint32_t nTokens;
+    uint32_t *tokenOffsets;      // distinct tokens in text
+    uint32_t *tokenPostingStarts;// nTokens + 1, into tokenPostings
+    uint32_t *tokenPostings;     // entries containing each token
+    uint32_t nTokenSlots;
+    uint32_t *tokenSlots;        // token id + 1, open addressing
+
+    uint32_t nGrams;
+    uint32_t *gramOffsets;       // every token substring up to GRAM_MAX
+    uint8_t *gramLengths;
+    uint32_t *gramPostingStarts; // nGrams + 1, into gramPostings
+    uint32_t *gramPostings;      // tokens containing each gram
+    uint32_t nGramSlots;
+    uint32_t *gramSlots;         // gram id + 1, open addressing
+
+    char *text;
+    uint32_t textLength;
+} LaunchTargetNameIndex;
+
 typedef struct PlayTime {
     uint64_t targetSignature;
     uint32_t msPlayed;
@@ -93,6 +292,21 @@ typedef struct PlayTimeFile {
     PlayTime entries[];
 } PlayTimeFile;
 
+// <user>.playranks, the play time entries' indexes in both home row 
+// orders, kept up to date as sessions end so the rows just read the front
+#define PLAY_TIME_RANK_VERSION 1
+
+typedef struct PlayTimeRank {
+    uint32_t byLastPlayed;  // most recently played first
+    uint32_t byMsPlayed;    // most played first
+} PlayTimeRank;
+
+typedef struct PlayTimeRankFile {
+    uint32_t nEntries;
+    uint32_t version;
+    PlayTimeRank entries[];
+} PlayTimeRankFile;
+
 typedef struct RAGameCache {
     uint64_t targetSignature;  // OffBlast's game ID
     uint32_t raGameId;         // RetroAchievements game ID
@@ -108,22 +322,350 @@ typedef struct RAGameCacheFile {
     RAGameCache entries[];
 } RAGameCacheFile;
 
+// Remembers what each scanned ROM matched so rescans can skip the matcher.
+// An entry only counts while the file, the search and the platform's
+// OpenGameDB CSV are all unchanged.
+#define ROM_MATCH_CACHE_VERSION 1
+
+typedef struct RomMatchCacheEntry {
+    uint64_t pathHash;
+    uint64_t fileSize;
+    uint64_t searchHash;       // match field and the name or id searched
+    uint64_t csvStamp;         // size and mtime of the platform's CSV
+    uint64_t targetSignature;  // 0 when nothing matched
+    uint32_t launcherSignature;
+    float matchScore;
+} RomMatchCacheEntry;
+
+typedef struct RomMatchCacheFile {
+    uint32_t nEntries;
+    uint32_t version;
+    RomMatchCacheEntry entries[];
+} RomMatchCacheFile;
+
+// A field of a CSV row as it sits in the mapped file. Quoted fields point
+// inside the quotes with any doubled quotes still in place, csvFieldCopy
+// collapses them.
+typedef struct CsvField {
+    const char *data;
+    uint32_t length;
+    uint32_t nEscapes;
+} CsvField;
+
+typedef struct CsvReader {
+    char *memory;
+    size_t size;
+    size_t cursor;
+    uint32_t row;
+    size_t blockStart;
+    uint64_t quoteMask;        // quotes in the block at blockStart
+    uint64_t delimiterMask;    // commas and line breaks in the same block
+    uint32_t blockLoaded;
+} CsvReader;
+
+// Columns of an OpenGameDB platform CSV, the first row is a header
+enum OpenGameDbColumn {
+    OPENGAMEDB_COLUMN_NAME = 0,
+    OPENGAMEDB_COLUMN_DATE = 1,
+    OPENGAMEDB_COLUMN_SCORE = 2,
+    OPENGAMEDB_COLUMN_METASCORE = 3,
+    OPENGAMEDB_COLUMN_DESCRIPTION = 5,
+    OPENGAMEDB_COLUMN_COVER_URL = 6,
+    OPENGAMEDB_COLUMN_ID = 7,
+    OPENGAMEDB_NUM_COLUMNS = 8
+};
+
+// The short columns of a row, copied out and NUL terminated. The 
+// description is left as a view into the CSV.
+typedef struct OpenGameDbRow {
+    char *name;
+    char *date;
+    char *score;
+    char *metaScore;
+    char *coverUrl;
+    char *id;
+    CsvField description;
+    uint64_t rowHash;          // of the raw row, never 0
+    char *buffer;
+    size_t bufferSize;
+} OpenGameDbRow;
+
+// A parsed OpenGameDB row waiting to be merged into the target db, its
+// strings live in the stage's string buffer and its description is a 
+// view into the mapped CSV or pack
+typedef struct StagedTarget {
+    uint64_t targetSignature;
+    uint64_t rowHash;
+    uint32_t ranking;
+    uint32_t nameOffset;
+    uint32_t coverUrlOffset;
+    uint32_t idOffset;
+    char date[10];
+    CsvField description;
+} StagedTarget;
+
+typedef struct OpenGameDbStage {
+    char platform[256];
+    uint64_t csvSize;
+    uint64_t csvMtime;
+    uint64_t contentHash[2];
+    CsvReader reader;
+    StagedTarget *targets;
+    uint32_t nTargets;
+    uint32_t targetCapacity;
+    char *strings;             // points into the pack when fromPack is set
+    size_t stringsUsed;
+    size_t stringsCapacity;
+    uint32_t fromPack;
+    uint32_t failed;
+} OpenGameDbStage;
+
+// ogdb.pack is the OpenGameDB CSVs already parsed, one section per CSV
+// with the size and content hash of the file it was built from. Offsets
+// are from the start of the pack, string offsets from the start of the 
+// platform's string block, which holds the descriptions too.
+#define OPENGAMEDB_PACK_MAGIC 0x4b50474f
+#define OPENGAMEDB_PACK_VERSION 2
+
+typedef struct OpenGameDbPackHeader {
+    uint32_t magic;
+    uint32_t version;
+    uint32_t nPlatforms;
+    uint32_t padding;
+    uint64_t packSize;
+} OpenGameDbPackHeader;
+
+typedef struct OpenGameDbPackPlatform {
+    char platform[256];
+    uint64_t csvSize;
+    uint64_t contentHash[2];
+    uint64_t targetsOffset;
+    uint64_t stringsOffset;
+    uint64_t stringsSize;
+    uint32_t nTargets;
+    uint32_t padding;
+} OpenGameDbPackPlatform;
+
+typedef struct OpenGameDbPackTarget {
+    uint64_t targetSignature;
+    uint64_t rowHash;
+    uint32_t ranking;
+    uint32_t nameOffset;
+    uint32_t coverUrlOffset;
+    uint32_t idOffset;
+    uint32_t descriptionOffset;
+    uint32_t descriptionLength;
+    char date[10];
+    char padding[6];
+} OpenGameDbPackTarget;
+
+typedef struct OpenGameDbPack {
+    char *memory;
+    size_t size;
+    OpenGameDbPackHeader *header;
+    OpenGameDbPackPlatform *platforms;
+} OpenGameDbPack;
+
+// What each target's OpenGameDB row looked like when it was last imported,
+// in ogdbrows.bin at the same index as the hot record. Targets that never
+// came from a CSV, or predate it, have a rowHash of 0.
+#define OPENGAMEDB_ROW_STATE_VERSION 1
+
+typedef struct OpenGameDbRowState {
+    uint64_t rowHash;
+} OpenGameDbRowState;
+
+typedef struct OpenGameDbRowStateFile {
+    uint32_t nEntries;
+    uint32_t version;
+    OpenGameDbRowState entries[];
+} OpenGameDbRowStateFile;
+
+// The CSV each platform was last imported from, in ogdbplatforms.bin. A 
+// platform whose CSV still has the same size and mtime isn't looked at.
+typedef struct OpenGameDbPlatformState {
+    char platform[256];
+    uint64_t csvSize;
+    uint64_t csvMtime;
+    uint64_t contentHash[2];
+} OpenGameDbPlatformState;
+
+typedef struct OpenGameDbPlatformStateFile {
+    uint32_t nEntries;
+    uint32_t version;
+    OpenGameDbPlatformState entries[];
+} OpenGameDbPlatformStateFile;
+
 
 int InitDbFile(char *, OffblastDbFile *dbFileStruct, 
         size_t itemSize);
 
+int openDbFileReadOnly(char *path, OffblastDbFile *dbFileStruct, 
+        size_t headerBytes);
+
+void closeDbFile(OffblastDbFile *dbFileStruct);
+
 void *growDbFileIfNecessary(OffblastDbFile* dbFileStruct,
         size_t itemSize,
         enum OffBlastDbType type);
 
+void beginDbBatch(OffblastDbBatch *batch, OffblastDbFile *dbFileStruct, 
+        size_t itemSize, enum OffBlastDbType type);
+
+// Room for n more items past the pending ones, returns the file's memory 
+// or NULL
+void *reserveDbBatch(OffblastDbBatch *batch, size_t n);
+
+int commitDbBatch(OffblastDbBatch *batch);
+
 int32_t launchTargetIndexByTargetSignature(LaunchTargetFile *file, 
         uint64_t targetSignature);
 
-int32_t launchTargetIndexByNameMatch(LaunchTargetFile *file, 
+int InitLaunchTargetDb(char *configPath, LaunchTargetDb *db);
+
+int openLaunchTargetDbReadOnly(char *configPath, LaunchTargetDb *db);
+
+int rebuildLaunchTargetIndex(LaunchTargetDb *db);
+
+int launchTargetIndexUsable(LaunchTargetDb *db);
+
+int32_t launchTargetIndexLookup(LaunchTargetDb *db, uint64_t targetSignature);
+
+int commitLaunchTargetBatch(LaunchTargetDb *db, OffblastDbBatch *batch);
+
+const LaunchTargetCold *launchTargetCold(LaunchTargetDb *db, 
+        LaunchTarget *target);
+
+LaunchTargetCold *appendLaunchTargetCold(LaunchTargetDb *db, 
+        LaunchTarget *target);
+
+char *launchTargetString(LaunchTargetDb *db, uint32_t offset);
+
+uint32_t storeLaunchTargetString(LaunchTargetDb *db, uint32_t offset,
+        const char *value, size_t maxLength);
+
+uint16_t launchTargetDictId(LaunchTargetDb *db, const char *value);
+
+uint16_t launchTargetDictLookup(LaunchTargetDb *db, const char *value);
+
+char *launchTargetDictValue(LaunchTargetDb *db, uint16_t id);
+
+int32_t launchTargetIndexByNameMatch(LaunchTargetDb *db, 
         char *search, char *platform, float *matchScore);
 
-int32_t launchTargetIndexByIdMatch(LaunchTargetFile *file,
+LaunchTargetNameIndex *newLaunchTargetNameIndex(LaunchTargetDb *db, 
+        char *platform);
+
+void freeLaunchTargetNameIndex(LaunchTargetNameIndex *index);
+
+int32_t launchTargetNameIndexMatch(LaunchTargetNameIndex *index, 
+        char *search, float *matchScore);
+
+int32_t launchTargetIndexByIdMatch(LaunchTargetDb *db,
         char *idStr, char *platform);
 
-int32_t launchTargetIndexByFieldMatch(LaunchTargetFile *file,
-        char *fieldName, char *searchValue, char *platform, float *matchScore);
+int32_t launchTargetIndexByFieldMatch(LaunchTargetDb *db,
+        LaunchTargetNameIndex *nameIndex, char *fieldName, 
+        char *searchValue, char *platform, float *matchScore);
+
+int openCsvReader(const char *path, CsvReader *reader);
+
+void closeCsvReader(CsvReader *reader);
+
+uint32_t nextCsvRow(CsvReader *reader, CsvField *fields, uint32_t maxFields);
+
+uint32_t csvFieldLength(const CsvField *field);
+
+char *csvFieldCopy(const CsvField *field, char *destination);
+
+uint32_t readOpenGameDbRow(CsvReader *reader, OpenGameDbRow *row);
+
+uint32_t openGameDbRanking(const char *scoreString, 
+        const char *metaScoreString);
+
+uint64_t openGameDbCsvMtime(struct stat *sb);
+
+int stageOpenGameDbPlatform(const char *openGameDbPath, 
+        OpenGameDbStage *stage, OpenGameDbPack *pack, uint32_t *rowsParsed);
+
+void freeOpenGameDbStage(OpenGameDbStage *stage);
+
+int mapOpenGameDbPack(const char *path, OpenGameDbPack *pack);
+
+void unmapOpenGameDbPack(OpenGameDbPack *pack);
+
+int writeOpenGameDbPack(const char *path, OpenGameDbStage *stages, 
+        uint32_t nStages, OpenGameDbPack *previous);
+
+// Opens descriptions.bin, first finishing any compaction that was 
+// interrupted
+int initDescriptionDb(char *path, OffblastDbFile *descriptions, 
+        LaunchTargetDb *db);
+
+int recoverDescriptionCompaction(char *path, LaunchTargetDb *db);
+
+size_t liveDescriptionBytes(OffblastDbFile *descriptions, LaunchTargetDb *db);
+
+// Rebuilds the file and retrains its dictionary, the codec is reloaded 
+// for the new file
+int compactDescriptionDb(char *path, OffblastDbFile *descriptions, 
+        DescriptionCodec *codec, LaunchTargetDb *db, 
+        DescriptionCompactionStats *stats);
+
+size_t liveLaunchTargetStringBytes(LaunchTargetDb *db);
+
+// Rewrites launchstrings.bin with one copy of each string still in use. 
+// Strings are read without a lock, so only call it while nothing else has 
+// the db open, on start or from offblast-db.
+int compactLaunchTargetStrings(char *configPath, LaunchTargetDb *db, 
+        LaunchTargetStringCompactionStats *stats);
+
+// Picks up the dictionary of a freshly opened or compacted file and drops 
+// anything cached from the old one
+void loadDescriptionCodec(DescriptionCodec *codec, 
+        OffblastDbFile *descriptions);
+
+// Returns the offset of the stored description or -1. It's compressed 
+// when the file has a dictionary and that makes it smaller.
+off_t appendDescription(OffblastDbBatch *batch, DescriptionCodec *codec, 
+        uint64_t targetSignature, const char *text, size_t length);
+
+// A malloc'd copy of the target's description, NULL if it has none
+char *decodeDescription(OffblastDbFile *descriptions, DescriptionCodec *codec,
+        LaunchTarget *target, off_t offset);
+
+// The target's description, "" if it has none. Compressed ones are kept in 
+// a small LRU and stay valid until DESCRIPTION_CACHE_SIZE others have been 
+// asked for.
+const char *descriptionText(OffblastDbFile *descriptions, 
+        DescriptionCodec *codec, LaunchTarget *target, off_t offset);
+
+// Opens the ranks, rebuilding them if they're out of step with the play 
+// times
+int initPlayTimeRanks(char *path, OffblastDbFile *ranks, 
+        PlayTimeFile *playTimes);
+
+int rebuildPlayTimeRanks(OffblastDbFile *ranks, PlayTimeFile *playTimes);
+
+// Call after a play time entry is added or changed
+int updatePlayTimeRank(OffblastDbFile *ranks, PlayTimeFile *playTimes, 
+        uint32_t index);
+
+// NULL unless the platform's targets are sharded right now
+LaunchTargetShard *findLaunchTargetShard(LaunchTargetDb *db, 
+        const char *platform);
+
+// Moves every target of the platforms flagged in evict, indexed by 
+// platform id, out to their shards. Platforms with anything installed, 
+// matched or owned stay where they are, as do ones that have been loaded 
+// back from a shard before.
+int evictLaunchTargetShards(char *configPath, LaunchTargetDb *db, 
+        OffblastDbFile *rowStates, OffblastDbFile *descriptions, 
+        DescriptionCodec *codec, const uint8_t *evict, uint32_t *nEvicted);
+
+// Appends a platform's targets back from its shard. A shard that can't be 
+// read is dropped and 0 returned, the platform then has to be imported 
+// from the OpenGameDB again.
+int loadLaunchTargetShard(char *configPath, LaunchTargetDb *db, 
+        OffblastDbFile *rowStates, OffblastDbFile *descriptions, 
+        DescriptionCodec *codec, const char *platform);
@@ -0,0 +1,995 @@
+#define _GNU_SOURCE
+#include <stdlib.h>
+#include <stdio.h>
+#include <stdarg.h>
+#include <stddef.h>
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <sys/types.h>
+#include <unistd.h>
+#include <string.h>
+#include <dirent.h>
+#include <time.h>
+#include <inttypes.h>
+#include "../offblast.h"
+#include "../offblastDbFile.h"
+
+// Inspects and maintains an OffBlast config directory without starting the
+// UI. The reports map every file read only and change nothing, not even 
+// what OffBlast would repair on start. reindex and compact rewrite files in 
+// place, so don't run them while OffBlast has the same directory open.
+//
+// usage: offblast-db <command> [config dir]
+//
+//   dump     the name, path and signature of every game with a launcher
+//   stats    entries, bytes used and fill ratio of each db file
+//   verify   checks offsets, ids, signatures and shards, exits 1 on problems
+//   reindex  rebuilds launchtargets.idx and the play time ranks
+//   compact  compacts launchstrings.bin and descriptions.bin
+//   bench    times signature lookups, scans and description decoding
+
+typedef struct DbTool {
+    char *configPath;
+    LaunchTargetDb db;
+    LaunchTargetFile *targets;
+    LaunchTargetColdFile *cold;
+    OffblastBlobFile *strings;
+    LaunchTargetDictFile *dictionary;
+    OffblastDbFile descriptions;    // memory is NULL when there's no file
+    DescriptionCodec codec;
+} DbTool;
+
+#define FIXED_FILE_BYTES(type, n) \
+    (offsetof(type, entries) + (size_t) (n) * FIELD_SIZEOF(type, entries[0]))
+
+// InitDbFile creates whatever is missing, which a report shouldn't do
+static int openExistingDbFile(char *configPath, const char *name,
+        OffblastDbFile *file, size_t headerBytes)
+{
+    char *path;
+    asprintf(&path, "%s/%s", configPath, name);
+    int ok = openDbFileReadOnly(path, file, headerBytes);
+    free(path);
+    return ok;
+}
+
+// Only reindex and compact get the repairing open, which migrates, syncs 
+// the index and evens up the cold file the way OffBlast does on start
+static int openDbTool(DbTool *tool, char *configPath, int repair)
+{
+    memset(tool, 0, sizeof(DbTool));
+    tool->configPath = configPath;
+
+    char *targetsPath;
+    asprintf(&targetsPath, "%s/launchtargets.bin", configPath);
+    int exists = access(targetsPath, F_OK) == 0;
+    free(targetsPath);
+
+    if (!exists) {
+        printf("no launch target db in %s\n", configPath);
+        return 0;
+    }
+
+    if (repair ? !InitLaunchTargetDb(configPath, &tool->db)
+            : !openLaunchTargetDbReadOnly(configPath, &tool->db))
+    {
+        printf("couldn't open the launch target db in %s\n", configPath);
+        return 0;
+    }
+
+    tool->targets = (LaunchTargetFile*) tool->db.targets.memory;
+    tool->cold = (LaunchTargetColdFile*) tool->db.cold.memory;
+    tool->strings = (OffblastBlobFile*) tool->db.strings.memory;
+    tool->dictionary = (LaunchTargetDictFile*) tool->db.dictionary.memory;
+
+    if (openExistingDbFile(configPath, "descriptions.bin",
+                &tool->descriptions, sizeof(OffblastBlobFile)))
+    {
+        loadDescriptionCodec(&tool->codec, &tool->descriptions);
+    }
+
+    return 1;
+}
+
+static double secondsSince(struct timespec *start)
+{
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (now.tv_sec - start->tv_sec)
+        + (now.tv_nsec - start->tv_nsec) / 1e9;
+}
+
+static int hasSuffix(const char *name, const char *suffix)
+{
+    size_t nameLength = strlen(name);
+    size_t suffixLength = strlen(suffix);
+    return nameLength > suffixLength
+        && strcmp(name + nameLength - suffixLength, suffix) == 0;
+}
+
+
+// __ dump __
+
+static int dumpTargets(DbTool *tool)
+{
+    for (uint32_t i = 0; i < tool->targets->nEntries; i++) {
+
+        LaunchTarget *target = &tool->targets->entries[i];
+
+        if (target->launcherSignature) {
+            const LaunchTargetCold *cold = launchTargetCold(&tool->db, target);
+            printf("%s\n%s\n%"PRIu64"\n\n",
+                    launchTargetString(&tool->db, target->nameOffset),
+                    cold ? launchTargetString(&tool->db, cold->pathOffset)
+                        : "",
+                    target->targetSignature);
+        }
+    }
+
+    return 0;
+}
+
+
+// __ stats __
+
+static void printFileStats(const char *name, OffblastDbFile *file,
+        uint64_t nEntries, size_t used)
+{
+    printf("%-22s %10"PRIu64" %14zu %14zu %6.1f%%\n", name, nEntries, used,
+            file->nBytesAllocated, file->nBytesAllocated
+                ? 100.0 * used / file->nBytesAllocated : 0.0);
+}
+
+static void printPlayTimeStats(char *configPath)
+{
+    DIR *dir = opendir(configPath);
+    if (dir == NULL) return;
+
+    struct dirent *entry;
+    while ((entry = readdir(dir)) != NULL) {
+        OffblastDbFile file;
+
+        if (hasSuffix(entry->d_name, ".playtime")
+                && openExistingDbFile(configPath, entry->d_name, &file,
+                    sizeof(PlayTimeFile)))
+        {
+            PlayTimeFile *playTimes = (PlayTimeFile*) file.memory;
+            printFileStats(entry->d_name, &file, playTimes->nEntries,
+                    FIXED_FILE_BYTES(PlayTimeFile, playTimes->nEntries));
+            closeDbFile(&file);
+        }
+        else if (hasSuffix(entry->d_name, ".playranks")
+                && openExistingDbFile(configPath, entry->d_name, &file,
+                    sizeof(PlayTimeRankFile)))
+        {
+            PlayTimeRankFile *ranks = (PlayTimeRankFile*) file.memory;
+            printFileStats(entry->d_name, &file, ranks->nEntries,
+                    FIXED_FILE_BYTES(PlayTimeRankFile, ranks->nEntries));
+            closeDbFile(&file);
+        }
+    }
+
+    closedir(dir);
+}
+
+static int printStats(DbTool *tool)
+{
+    LaunchTargetDb *db = &tool->db;
+
+    printf("\n%-22s %10s %14s %14s %7s\n",
+            "file", "entries", "bytes used", "bytes on disk", "fill");
+
+    printFileStats("launchtargets.bin", &db->targets,
+            tool->targets->nEntries,
+            FIXED_FILE_BYTES(LaunchTargetFile, tool->targets->nEntries));
+
+    printFileStats("launchtargets.cold", &db->cold, tool->cold->nEntries,
+            FIXED_FILE_BYTES(LaunchTargetColdFile, tool->cold->nEntries));
+
+    printFileStats("launchstrings.bin", &db->strings, 0,
+            sizeof(OffblastBlobFile) + tool->strings->cursor);
+
+    printFileStats("launchdictionary.bin", &db->dictionary,
+            tool->dictionary->nEntries,
+            FIXED_FILE_BYTES(LaunchTargetDictFile,
+                tool->dictionary->nEntries));
+
+    LaunchTargetIndexFile *index = (LaunchTargetIndexFile*) db->index.memory;
+    if (index) {
+        printFileStats("launchtargets.idx", &db->index, index->nIndexed,
+                sizeof(LaunchTargetIndexFile)
+                    + index->nSlots * sizeof(LaunchTargetIndexSlot));
+    }
+
+    LaunchTargetShardFile *shards = (LaunchTargetShardFile*) db->shards.memory;
+    if (shards) {
+        printFileStats("launchshards.bin", &db->shards, shards->nEntries,
+                FIXED_FILE_BYTES(LaunchTargetShardFile, shards->nEntries));
+    }
+
+    OffblastBlobFile *descriptionFile =
+        (OffblastBlobFile*) tool->descriptions.memory;
+    if (descriptionFile) {
+        printFileStats("descriptions.bin", &tool->descriptions, 0,
+                sizeof(OffblastBlobFile) + descriptionFile->cursor);
+    }
+
+    OffblastDbFile file;
+    if (openExistingDbFile(tool->configPath, "ogdbrows.bin", &file,
+                sizeof(OpenGameDbRowStateFile)))
+    {
+        OpenGameDbRowStateFile *rows = (OpenGameDbRowStateFile*) file.memory;
+        printFileStats("ogdbrows.bin", &file, rows->nEntries,
+                FIXED_FILE_BYTES(OpenGameDbRowStateFile, rows->nEntries));
+        closeDbFile(&file);
+    }
+
+    if (openExistingDbFile(tool->configPath, "ogdbplatforms.bin", &file,
+                sizeof(OpenGameDbPlatformStateFile)))
+    {
+        OpenGameDbPlatformStateFile *platforms =
+            (OpenGameDbPlatformStateFile*) file.memory;
+        printFileStats("ogdbplatforms.bin", &file, platforms->nEntries,
+                FIXED_FILE_BYTES(OpenGameDbPlatformStateFile,
+                    platforms->nEntries));
+        closeDbFile(&file);
+    }
+
+    if (openExistingDbFile(tool->configPath, "rommatches.bin", &file,
+                sizeof(RomMatchCacheFile)))
+    {
+        RomMatchCacheFile *matches = (RomMatchCacheFile*) file.memory;
+        printFileStats("rommatches.bin", &file, matches->nEntries,
+                FIXED_FILE_BYTES(RomMatchCacheFile, matches->nEntries));
+        closeDbFile(&file);
+    }
+
+    printPlayTimeStats(tool->configPath);
+
+    if (index) {
+        printf("\nindex: %"PRIu64" slots, load factor %.2f\n",
+                index->nSlots, (double) index->nIndexed / index->nSlots);
+    }
+
+    if (descriptionFile) {
+        size_t live = liveDescriptionBytes(&tool->descriptions, db);
+        printf("descriptions: %zu of %zu bytes live (%.1f%%), "
+                "%u byte dictionary\n", live, (size_t) descriptionFile->cursor,
+                descriptionFile->cursor
+                    ? 100.0 * live / descriptionFile->cursor : 0.0,
+                tool->codec.dictionaryLength);
+    }
+
+    // Per platform, the same split the row builders see
+    uint32_t nIds = tool->dictionary->nEntries + 1;
+    uint32_t *nTargets = calloc(nIds, sizeof(uint32_t));
+    uint32_t *nLaunchable = calloc(nIds, sizeof(uint32_t));
+    uint32_t *nInstalled = calloc(nIds, sizeof(uint32_t));
+    if (!nTargets || !nLaunchable || !nInstalled) {
+        printf("out of memory\n");
+        return 1;
+    }
+
+    for (uint32_t i = 0; i < tool->targets->nEntries; ++i) {
+        LaunchTarget *target = &tool->targets->entries[i];
+        if (target->platformId >= nIds) continue;
+
+        nTargets[target->platformId]++;
+        if (target->launcherSignature) nLaunchable[target->platformId]++;
+        if (target->flags & LAUNCH_TARGET_INSTALLED) {
+            nInstalled[target->platformId]++;
+        }
+    }
+
+    printf("\n%-32s %10s %10s %10s\n",
+            "platform", "targets", "launcher", "installed");
+    for (uint32_t id = 0; id < nIds; ++id) {
+        if (nTargets[id] == 0) continue;
+        printf("%-32s %10u %10u %10u\n",
+                id ? launchTargetDictValue(db, id) : "(none)",
+                nTargets[id], nLaunchable[id], nInstalled[id]);
+    }
+
+    for (uint32_t i = 0; shards && i < shards->nEntries; ++i) {
+        if (shards->entries[i].flags & LAUNCH_TARGET_SHARD_LOADED) continue;
+        printf("%-32s %10u %10s %10s\n", shards->entries[i].platform,
+                shards->entries[i].nTargets, "sharded", "");
+    }
+
+    free(nTargets);
+    free(nLaunchable);
+    free(nInstalled);
+
+    return 0;
+}
+
+
+// __ verify __
+
+static uint32_t nProblems;
+
+static void problem(const char *format, ...)
+{
+    va_list args;
+    va_start(args, format);
+    vprintf(format, args);
+    va_end(args);
+
+    nProblems++;
+}
+
+static int heapStringValid(OffblastBlobFile *heap, uint32_t offset)
+{
+    return offset < (size_t) heap->cursor
+        && memchr(&heap->memory[offset], '\0', heap->cursor - offset);
+}
+
+// Straight from the slots, launchTargetIndexLookup falls back to a scan
+static int64_t indexedEntry(LaunchTargetIndexFile *index,
+        uint64_t targetSignature)
+{
+    uint64_t mask = index->nSlots - 1;
+    uint64_t slot = targetSignature & mask;
+
+    for (uint64_t probes = 0; probes < index->nSlots; ++probes) {
+        if (index->slots[slot].entryIndexPlusOne == 0) return -1;
+        if (index->slots[slot].targetSignature == targetSignature) {
+            return (int64_t) index->slots[slot].entryIndexPlusOne - 1;
+        }
+        slot = (slot + 1) & mask;
+    }
+
+    return -1;
+}
+
+static int compareSignatures(const void *a, const void *b)
+{
+    uint64_t left = *(const uint64_t*) a;
+    uint64_t right = *(const uint64_t*) b;
+    return left < right ? -1 : left > right;
+}
+
+// Nothing else can be checked if the headers don't fit their files
+static int verifyFileSizes(DbTool *tool)
+{
+    uint32_t nBefore = nProblems;
+
+    LaunchTargetDb *db = &tool->db;
+
+    if (FIXED_FILE_BYTES(LaunchTargetFile, tool->targets->nEntries)
+            > db->targets.nBytesAllocated)
+    {
+        problem("launchtargets.bin claims %u entries, more than it holds\n",
+                tool->targets->nEntries);
+    }
+
+    if (FIXED_FILE_BYTES(LaunchTargetColdFile, tool->cold->nEntries)
+            > db->cold.nBytesAllocated)
+    {
+        problem("launchtargets.cold claims %u entries, more than it holds\n",
+                tool->cold->nEntries);
+    }
+
+    if (tool->strings->cursor < 1
+            || sizeof(OffblastBlobFile) + tool->strings->cursor
+                > db->strings.nBytesAllocated
+            || tool->strings->memory[0] != '\0')
+    {
+        problem("launchstrings.bin cursor %jd is out of range\n",
+                (intmax_t) tool->strings->cursor);
+    }
+
+    if (FIXED_FILE_BYTES(LaunchTargetDictFile, tool->dictionary->nEntries)
+            > db->dictionary.nBytesAllocated)
+    {
+        problem("launchdictionary.bin claims %u entries, more than it "
+                "holds\n", tool->dictionary->nEntries);
+    }
+
+    OffblastBlobFile *descriptionFile =
+        (OffblastBlobFile*) tool->descriptions.memory;
+    if (descriptionFile && sizeof(OffblastBlobFile) + descriptionFile->cursor
+            > tool->descriptions.nBytesAllocated)
+    {
+        problem("descriptions.bin cursor %jd is past the end of the file\n",
+                (intmax_t) descriptionFile->cursor);
+    }
+
+    return nProblems == nBefore;
+}
+
+static void verifyIndex(DbTool *tool)
+{
+    LaunchTargetIndexFile *index =
+        (LaunchTargetIndexFile*) tool->db.index.memory;
+    LaunchTargetFile *targets = tool->targets;
+
+    if (index == NULL) {
+        problem("launchtargets.idx couldn't be opened\n");
+        return;
+    }
+
+    if (index->version != LAUNCH_TARGET_INDEX_VERSION) {
+        problem("launchtargets.idx is version %u, not %d\n", index->version,
+                LAUNCH_TARGET_INDEX_VERSION);
+        return;
+    }
+
+    if (index->nSlots == 0 || (index->nSlots & (index->nSlots - 1)) != 0
+            || sizeof(LaunchTargetIndexFile)
+                + index->nSlots * sizeof(LaunchTargetIndexSlot)
+                    > tool->db.index.nBytesAllocated)
+    {
+        problem("launchtargets.idx has a bad slot count %"PRIu64"\n",
+                index->nSlots);
+        return;
+    }
+
+    if (index->nIndexed != targets->nEntries) {
+        problem("launchtargets.idx covers %u of %u targets\n",
+                index->nIndexed, targets->nEntries);
+    }
+    else if (index->nIndexed > 0 && index->lastSignature
+            != targets->entries[index->nIndexed - 1].targetSignature)
+    {
+        problem("launchtargets.idx was built for different targets\n");
+    }
+
+    uint32_t nMissing = 0;
+    uint32_t nWrong = 0;
+    for (uint32_t i = 0; i < targets->nEntries && i < index->nIndexed; ++i) {
+        int64_t entry = indexedEntry(index,
+                targets->entries[i].targetSignature);
+
+        // Duplicates point at the first copy
+        if (entry == -1) nMissing++;
+        else if (entry > i || entry >= targets->nEntries
+                || targets->entries[entry].targetSignature
+                    != targets->entries[i].targetSignature)
+        {
+            nWrong++;
+        }
+    }
+
+    if (nMissing) problem("%u targets are missing from the index\n", nMissing);
+    if (nWrong) problem("%u index slots point at the wrong target\n", nWrong);
+}
+
+static void verifyTargets(DbTool *tool)
+{
+    LaunchTargetFile *targets = tool->targets;
+    OffblastBlobFile *descriptionFile =
+        (OffblastBlobFile*) tool->descriptions.memory;
+
+    uint32_t nBadStrings = 0;
+    uint32_t nBadIds = 0;
+    uint32_t nBadDescriptions = 0;
+    uint32_t nZeroSignatures = 0;
+
+    for (uint32_t i = 0; i < targets->nEntries; ++i) {
+        LaunchTarget *target = &targets->entries[i];
+
+        if (target->targetSignature == 0) nZeroSignatures++;
+
+        if (!heapStringValid(tool->strings, target->nameOffset)) {
+            nBadStrings++;
+        }
+
+        if (target->platformId > tool->dictionary->nEntries
+                || target->ownerId > tool->dictionary->nEntries)
+        {
+            nBadIds++;
+        }
+
+        if (i >= tool->cold->nEntries) continue;
+        LaunchTargetCold *cold = &tool->cold->entries[i];
+
+        if (!heapStringValid(tool->strings, cold->idOffset)
+                || !heapStringValid(tool->strings, cold->pathOffset)
+                || !heapStringValid(tool->strings, cold->coverUrlOffset))
+        {
+            nBadStrings++;
+        }
+
+        if (descriptionFile && cold->descriptionOffset != 0) {
+            char *text = decodeDescription(&tool->descriptions, &tool->codec,
+                    target, cold->descriptionOffset);
+            if (text == NULL) nBadDescriptions++;
+            free(text);
+        }
+    }
+
+    if (nZeroSignatures) {
+        problem("%u targets have no signature\n", nZeroSignatures);
+    }
+    if (nBadStrings) {
+        problem("%u targets point outside the string heap\n", nBadStrings);
+    }
+    if (nBadIds) {
+        problem("%u targets have platform or owner ids missing from the "
+                "dictionary\n", nBadIds);
+    }
+    if (nBadDescriptions) {
+        problem("%u targets have descriptions that don't decode\n",
+                nBadDescriptions);
+    }
+
+    // Every target gets its cold record when it's appended
+    if (tool->cold->nEntries != targets->nEntries) {
+        problem("launchtargets.cold has %u records for %u targets\n",
+                tool->cold->nEntries, targets->nEntries);
+    }
+
+    uint64_t *signatures = malloc(((size_t) targets->nEntries + 1)
+            * sizeof(uint64_t));
+    if (signatures == NULL) return;
+
+    for (uint32_t i = 0; i < targets->nEntries; ++i) {
+        signatures[i] = targets->entries[i].targetSignature;
+    }
+    qsort(signatures, targets->nEntries, sizeof(uint64_t), compareSignatures);
+
+    uint32_t nDuplicates = 0;
+    for (uint32_t i = 1; i < targets->nEntries; ++i) {
+        if (signatures[i] == signatures[i - 1]) nDuplicates++;
+    }
+    free(signatures);
+
+    if (nDuplicates) {
+        problem("%u targets share a signature with an earlier one\n",
+                nDuplicates);
+    }
+}
+
+static void verifyShards(DbTool *tool)
+{
+    LaunchTargetShardFile *shards =
+        (LaunchTargetShardFile*) tool->db.shards.memory;
+    if (shards == NULL) return;
+
+    if (shards->version > LAUNCH_TARGET_SHARD_VERSION
+            && shards->nEntries != 0)
+    {
+        problem("launchshards.bin is version %u, not %d\n", shards->version,
+                LAUNCH_TARGET_SHARD_VERSION);
+        return;
+    }
+
+    // OffBlast drops them when they're needed and imports them again
+    if (shards->version < LAUNCH_TARGET_SHARD_VERSION
+            && shards->nEntries != 0)
+    {
+        printf("note: launchshards.bin is version %u, its shards will be "
+                "imported again\n", shards->version);
+        return;
+    }
+
+    if (FIXED_FILE_BYTES(LaunchTargetShardFile, shards->nEntries)
+            > tool->db.shards.nBytesAllocated)
+    {
+        problem("launchshards.bin claims %u entries, more than it holds\n",
+                shards->nEntries);
+        return;
+    }
+
+    for (uint32_t i = 0; i < shards->nEntries; ++i) {
+        LaunchTargetShard *shard = &shards->entries[i];
+        if (shard->flags & LAUNCH_TARGET_SHARD_LOADED) continue;
+
+        char *path;
+        asprintf(&path, "%s/shards/%s.bin", tool->configPath,
+                shard->platform);
+
+        LaunchTargetShardHeader header;
+        struct stat sb;
+        FILE *file = fopen(path, "rb");
+
+        if (file == NULL || fstat(fileno(file), &sb) != 0
+                || fread(&header, sizeof(header), 1, file) != 1)
+        {
+            problem("shard %s is missing or unreadable\n", path);
+        }
+        else if (header.magic != LAUNCH_TARGET_SHARD_MAGIC
+                || header.version != LAUNCH_TARGET_SHARD_VERSION
+                || strncmp(header.platform, shard->platform,
+                    sizeof(header.platform)) != 0)
+        {
+            problem("shard %s has a bad header\n", path);
+        }
+        else if (header.nTargets != shard->nTargets
+                || (uint64_t) sb.st_size != sizeof(header)
+                    + (uint64_t) header.nTargets
+                        * sizeof(LaunchTargetShardRecord)
+                    + header.textLength)
+        {
+            problem("shard %s holds %u targets in %jd bytes, "
+                    "launchshards.bin expects %u\n", path, header.nTargets,
+                    (intmax_t) sb.st_size, shard->nTargets);
+        }
+
+        if (file) fclose(file);
+        free(path);
+    }
+}
+
+static void verifyPlayTimeRanks(char *configPath)
+{
+    DIR *dir = opendir(configPath);
+    if (dir == NULL) return;
+
+    struct dirent *entry;
+    while ((entry = readdir(dir)) != NULL) {
+        if (!hasSuffix(entry->d_name, ".playranks")) continue;
+
+        char *playTimeName = strdup(entry->d_name);
+        strcpy(strrchr(playTimeName, '.'), ".playtime");
+
+        OffblastDbFile rankDb;
+        OffblastDbFile playTimeDb;
+        if (!openExistingDbFile(configPath, entry->d_name, &rankDb,
+                    sizeof(PlayTimeRankFile)))
+        {
+            free(playTimeName);
+            continue;
+        }
+
+        if (!openExistingDbFile(configPath, playTimeName, &playTimeDb,
+                    sizeof(PlayTimeFile)))
+        {
+            problem("%s has no %s\n", entry->d_name, playTimeName);
+            closeDbFile(&rankDb);
+            free(playTimeName);
+            continue;
+        }
+
+        PlayTimeRankFile *ranks = (PlayTimeRankFile*) rankDb.memory;
+        PlayTimeFile *playTimes = (PlayTimeFile*) playTimeDb.memory;
+
+        // OffBlast rebuilds them on load, so stale ranks aren't damage
+        if (ranks->version != PLAY_TIME_RANK_VERSION
+                || ranks->nEntries != playTimes->nEntries)
+        {
+            printf("note: %s is stale and will be rebuilt\n", entry->d_name);
+        }
+        else {
+            for (uint32_t i = 0; i < ranks->nEntries; ++i) {
+                if (ranks->entries[i].byLastPlayed >= playTimes->nEntries
+                        || ranks->entries[i].byMsPlayed
+                            >= playTimes->nEntries)
+                {
+                    problem("%s points past the end of %s\n",
+                            entry->d_name, playTimeName);
+                    break;
+                }
+            }
+        }
+
+        closeDbFile(&rankDb);
+        closeDbFile(&playTimeDb);
+        free(playTimeName);
+    }
+
+    closedir(dir);
+}
+
+static int verifyDb(DbTool *tool)
+{
+    nProblems = 0;
+
+    if (verifyFileSizes(tool)) {
+        verifyIndex(tool);
+        verifyTargets(tool);
+    }
+    verifyShards(tool);
+    verifyPlayTimeRanks(tool->configPath);
+
+    if (nProblems) {
+        printf("%u problems found\n", nProblems);
+        return 1;
+    }
+
+    printf("%u targets ok\n", tool->targets->nEntries);
+    return 0;
+}
+
+
+// __ reindex __
+
+static int reindexDb(DbTool *tool)
+{
+    if (tool->db.index.memory == NULL
+            || !rebuildLaunchTargetIndex(&tool->db))
+    {
+        printf("couldn't rebuild the launch target index\n");
+        return 1;
+    }
+
+    DIR *dir = opendir(tool->configPath);
+    if (dir == NULL) return 0;
+
+    int ok = 1;
+    struct dirent *entry;
+    while ((entry = readdir(dir)) != NULL) {
+        if (!hasSuffix(entry->d_name, ".playtime")) continue;
+
+        OffblastDbFile playTimeDb;
+        if (!openExistingDbFile(tool->configPath, entry->d_name,
+                    &playTimeDb, sizeof(PlayTimeFile)))
+        {
+            continue;
+        }
+
+        char *rankPath;
+        asprintf(&rankPath, "%s/%.*s.playranks", tool->configPath,
+                (int) (strlen(entry->d_name) - strlen(".playtime")),
+                entry->d_name);
+
+        OffblastDbFile rankDb = {0};
+        PlayTimeFile *playTimes = (PlayTimeFile*) playTimeDb.memory;
+        if (InitDbFile(rankPath, &rankDb, sizeof(PlayTimeRank))
+                && rebuildPlayTimeRanks(&rankDb, playTimes))
+        {
+            printf("ranked %u play times in %s\n", playTimes->nEntries,
+                    rankPath);
+        }
+        else {
+            printf("couldn't rebuild %s\n", rankPath);
+            ok = 0;
+        }
+
+        if (rankDb.memory) closeDbFile(&rankDb);
+        closeDbFile(&playTimeDb);
+        free(rankPath);
+    }
+
+    closedir(dir);
+    return ok ? 0 : 1;
+}
+
+
+// __ compact __
+
+// An interrupted compaction has already been finished by the repairing open
+static int compactStrings(DbTool *tool)
+{
+    LaunchTargetStringCompactionStats stats;
+    if (!compactLaunchTargetStrings(tool->configPath, &tool->db, &stats)) {
+        printf("couldn't compact the launch target strings\n");
+        return 1;
+    }
+    tool->strings = (OffblastBlobFile*) tool->db.strings.memory;
+
+    printf("Compacted launch target strings from %zu to %zu bytes, "
+            "%u stored, %u shared\n", stats.bytesBefore, stats.bytesAfter,
+            stats.nStored, stats.nShared);
+
+    return 0;
+}
+
+static int compactDescriptions(DbTool *tool)
+{
+    if (tool->descriptions.memory == NULL) {
+        printf("no descriptions.bin in %s\n", tool->configPath);
+        return 1;
+    }
+
+    // Reopened through initDescriptionDb so an interrupted compaction is
+    // finished first
+    closeDbFile(&tool->descriptions);
+
+    char *path;
+    asprintf(&path, "%s/descriptions.bin", tool->configPath);
+
+    DescriptionCompactionStats stats;
+    int ok = initDescriptionDb(path, &tool->descriptions, &tool->db);
+    if (ok) {
+        loadDescriptionCodec(&tool->codec, &tool->descriptions);
+        ok = compactDescriptionDb(path, &tool->descriptions, &tool->codec,
+                &tool->db, &stats);
+    }
+    free(path);
+
+    if (!ok) {
+        printf("couldn't compact the descriptions\n");
+        return 1;
+    }
+
+    printf("Compacted descriptions from %zu to %zu bytes, %u stored, "
+            "%u shared, %u compressed with a %u byte dictionary\n",
+            stats.bytesBefore, stats.bytesAfter, stats.nStored,
+            stats.nShared, stats.nCompressed, stats.dictionaryLength);
+
+    return 0;
+}
+
+static int compactDb(DbTool *tool)
+{
+    int result = compactStrings(tool);
+    return compactDescriptions(tool) || result;
+}
+
+
+// __ bench __
+
+#define BENCH_MIN_LOOKUPS (1 << 20)
+#define BENCH_LINEAR_SAMPLES 1000
+#define BENCH_SCAN_PASSES 100
+
+static void printBench(const char *name, double seconds, uint64_t nOps,
+        const char *unit)
+{
+    printf("%-26s %12"PRIu64" %-12s %10.1f ns each %10.2f ms total\n",
+            name, nOps, unit, nOps ? seconds * 1e9 / nOps : 0.0,
+            seconds * 1e3);
+}
+
+static int benchDb(DbTool *tool)
+{
+    LaunchTargetDb *db = &tool->db;
+    LaunchTargetFile *targets = tool->targets;
+    uint32_t n = targets->nEntries;
+    volatile uint64_t sink = 0;
+    struct timespec start;
+
+    if (n == 0) {
+        printf("no targets to time\n");
+        return 1;
+    }
+
+    printf("%u targets\n\n", n);
+
+    // Only OffBlast or reindex brings it up to date
+    if (db->index.memory && !launchTargetIndexUsable(db)) {
+        printf("launchtargets.idx is stale, lookups fall back to a scan\n\n");
+        closeDbFile(&db->index);
+    }
+
+    // Hits, the way the UI resolves play times and list entries
+    uint64_t nOps = 0;
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    while (nOps < BENCH_MIN_LOOKUPS) {
+        for (uint32_t i = 0; i < n; ++i) {
+            sink += launchTargetIndexLookup(db,
+                    targets->entries[i].targetSignature);
+        }
+        nOps += n;
+    }
+    printBench("index lookup, hit", secondsSince(&start), nOps, "lookups");
+
+    // Misses, the way imports check for new signatures
+    nOps = 0;
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    while (nOps < BENCH_MIN_LOOKUPS) {
+        for (uint32_t i = 0; i < n; ++i) {
+            sink += launchTargetIndexLookup(db,
+                    ~targets->entries[i].targetSignature);
+        }
+        nOps += n;
+    }
+    printBench("index lookup, miss", secondsSince(&start), nOps, "lookups");
+
+    uint32_t nSamples = n < BENCH_LINEAR_SAMPLES ? n : BENCH_LINEAR_SAMPLES;
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    for (uint32_t i = 0; i < nSamples; ++i) {
+        uint64_t signature =
+            targets->entries[(uint64_t) i * n / nSamples].targetSignature;
+        sink += launchTargetIndexByTargetSignature(targets, signature);
+    }
+    printBench("linear lookup, hit", secondsSince(&start), nSamples,
+            "lookups");
+
+    // What every row builder does, filter the hot records by platform
+    uint16_t steamId = launchTargetDictLookup(db, "steam");
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    for (uint32_t pass = 0; pass < BENCH_SCAN_PASSES; ++pass) {
+        for (uint32_t i = 0; i < n; ++i) {
+            LaunchTarget *target = &targets->entries[i];
+            if (target->launcherSignature != 0
+                    || target->platformId == steamId)
+            {
+                sink += target->ranking;
+            }
+        }
+    }
+    printBench("hot record scan", secondsSince(&start),
+            (uint64_t) n * BENCH_SCAN_PASSES, "targets");
+
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    for (uint32_t pass = 0; pass < BENCH_SCAN_PASSES; ++pass) {
+        for (uint32_t i = 0; i < n; ++i) {
+            sink += strlen(launchTargetString(db,
+                        targets->entries[i].nameOffset));
+        }
+    }
+    printBench("name scan", secondsSince(&start),
+            (uint64_t) n * BENCH_SCAN_PASSES, "names");
+
+    uint32_t nCold = tool->cold->nEntries < n ? tool->cold->nEntries : n;
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    for (uint32_t pass = 0; pass < BENCH_SCAN_PASSES; ++pass) {
+        for (uint32_t i = 0; i < nCold; ++i) {
+            const LaunchTargetCold *cold = launchTargetCold(db,
+                    &targets->entries[i]);
+            sink += strlen(launchTargetString(db, cold->pathOffset));
+        }
+    }
+    printBench("cold record scan", secondsSince(&start),
+            (uint64_t) nCold * BENCH_SCAN_PASSES, "targets");
+
+    if (tool->descriptions.memory) {
+        uint64_t nDecoded = 0;
+        uint64_t nBytes = 0;
+
+        clock_gettime(CLOCK_MONOTONIC, &start);
+        for (uint32_t i = 0; i < nCold; ++i) {
+            off_t offset = tool->cold->entries[i].descriptionOffset;
+            if (offset == 0) continue;
+
+            char *text = decodeDescription(&tool->descriptions, &tool->codec,
+                    &targets->entries[i], offset);
+            if (text) {
+                nBytes += strlen(text);
+                nDecoded++;
+            }
+            free(text);
+        }
+        double seconds = secondsSince(&start);
+        printBench("description decode", seconds, nDecoded, "descriptions");
+        printf("%-26s %12.1f MB/s\n", "",
+                seconds > 0 ? nBytes / seconds / 1e6 : 0.0);
+    }
+
+    (void) sink;
+    return 0;
+}
+
+
+int main (int argc, char **argv) {
+
+    if (argc < 2) {
+        printf("usage: %s <dump|stats|verify|reindex|compact|bench> "
+                "[config dir]\n", argv[0]);
+        return 1;
+    }
+
+    char *command = argv[1];
+    char *configPath;
+    if (argc > 2) {
+        configPath = strdup(argv[2]);
+    }
+    else {
+        char *homePath = getenv("HOME");
+        if (homePath == NULL) {
+            printf("HOME isn't set, pass the config dir\n");
+            return 1;
+        }
+        asprintf(&configPath, "%s/.offblast", homePath);
+    }
+
+    int (*run)(DbTool *tool) = NULL;
+    int repair = 0;
+    if (strcmp(command, "dump") == 0) run = dumpTargets;
+    else if (strcmp(command, "stats") == 0) run = printStats;
+    else if (strcmp(command, "verify") == 0) run = verifyDb;
+    else if (strcmp(command, "reindex") == 0) {
+        run = reindexDb;
+        repair = 1;
+    }
+    else if (strcmp(command, "compact") == 0) {
+        run = compactDb;
+        repair = 1;
+    }
+    else if (strcmp(command, "bench") == 0) run = benchDb;
+    else {
+        printf("unknown command %s\n", command);
+        return 1;
+    }
+
+    DbTool tool;
+    if (!openDbTool(&tool, configPath, repair)) return 1;
+
+    int result = run(&tool);
+
+    free(configPath);
+    return result;
+}
@@ -0,0 +1,85 @@
+#define _GNU_SOURCE
+#include <stdlib.h>
+#include <stdio.h>
+#include <stdint.h>
+#include <string.h>
+#include <dirent.h>
+#include <linux/limits.h>
+#include "../offblast.h"
+#include "../offblastDbFile.h"
+
+// Compiles an OpenGameDB checkout into ogdb.pack, which OffBlast maps on
+// startup instead of parsing any CSV the pack still matches.
+//
+// usage: ogdbpack <opengamedb dir> [pack path]
+int main (int argc, char **argv) {
+
+    if (argc < 2) {
+        printf("usage: %s <opengamedb dir> [pack path]\n", argv[0]);
+        return 1;
+    }
+
+    char *openGameDbPath = argv[1];
+    char *packPath;
+    if (argc > 2) {
+        packPath = strdup(argv[2]);
+    }
+    else {
+        asprintf(&packPath, "%s/ogdb.pack", openGameDbPath);
+    }
+
+    DIR *openGameDbDir = opendir(openGameDbPath);
+    if (openGameDbDir == NULL) {
+        printf("couldn't open %s\n", openGameDbPath);
+        return 1;
+    }
+
+    OpenGameDbStage *stages = NULL;
+    uint32_t nStages = 0;
+    struct dirent *entry;
+
+    while ((entry = readdir(openGameDbDir)) != NULL) {
+        if (entry->d_name[0] == '.') continue;
+        char *ext = strrchr(entry->d_name, '.');
+        if (ext == NULL || strcmp(ext, ".csv") != 0) continue;
+
+        // Same as the app, Steam games come from the API
+        if (strcmp(entry->d_name, "steam.csv") == 0) continue;
+
+        OpenGameDbStage *grown =
+            realloc(stages, (nStages + 1) * sizeof(OpenGameDbStage));
+        if (!grown) {
+            printf("out of memory\n");
+            return 1;
+        }
+        stages = grown;
+
+        *ext = '\0';
+        OpenGameDbStage *stage = &stages[nStages++];
+        memset(stage, 0, sizeof(OpenGameDbStage));
+        snprintf(stage->platform, sizeof(stage->platform), "%s", entry->d_name);
+    }
+    closedir(openGameDbDir);
+
+    uint32_t nTargets = 0;
+    for (uint32_t i = 0; i < nStages; ++i) {
+        if (stageOpenGameDbPlatform(openGameDbPath, &stages[i], NULL, NULL)) {
+            printf("%s\t%u games\n", stages[i].platform, stages[i].nTargets);
+            nTargets += stages[i].nTargets;
+        }
+    }
+
+    int ok = writeOpenGameDbPack(packPath, stages, nStages, NULL);
+    if (ok) {
+        printf("packed %u games from %u csv files into %s\n",
+                nTargets, nStages, packPath);
+    }
+
+    for (uint32_t i = 0; i < nStages; ++i) {
+        freeOpenGameDbStage(&stages[i]);
+    }
+    free(stages);
+    free(packPath);
+
+    return ok ? 0 : 1;
+}
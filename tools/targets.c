@@ -1,45 +0,0 @@
-#define _GNU_SOURCE
-#include <stdlib.h>
-#include <stdio.h>
-#include <errno.h>
-#include <fcntl.h>
-#include <sys/mman.h>
-#include <sys/stat.h>
-#include <sys/types.h>
-#include <unistd.h>
-#include <string.h>
-#include <assert.h>
-#include "../offblast.h"
-#include "../offblastDbFile.h"
-
-int main () {
-
-    char *homePath = getenv("HOME");
-    assert(homePath);
-
-    char *configPath;
-    asprintf(&configPath, "%s/.offblast", homePath);
-
-    char *launchTargetDbPath;
-    asprintf(&launchTargetDbPath, "%s/launchtargets.bin", configPath);
-    OffblastDbFile launchTargetDb = {0};
-    if (!InitDbFile(launchTargetDbPath, &launchTargetDb, 
-                sizeof(LaunchTarget))) 
-    {
-        printf("couldn't initialize path db, exiting\n");
-        return 1;
-    }
-    LaunchTargetFile *launchTargetFile = 
-        (LaunchTargetFile*) launchTargetDb.memory;
-    free(launchTargetDbPath);
-
-    for (uint32_t i = launchTargetFile->nEntries; i > 0; i--) {
-
-        LaunchTarget *target = &launchTargetFile->entries[i];
-
-        if (target->launcherSignature) 
-        printf("%s\n%s\n%"PRIu64"\n\n", target->name, target->path, target->targetSignature);
-    }
-
-    return 0;
-}
@@ -1,4 +1,14 @@
 #/bin/sh
 rm ~/.offblast/descriptions.bin
 rm ~/.offblast/launchtargets.bin
+rm ~/.offblast/launchtargets.cold
+rm ~/.offblast/launchtargets.idx
+rm ~/.offblast/launchstrings.bin
+rm ~/.offblast/launchdictionary.bin
 rm ~/.offblast/launchercontents.bin
+rm ~/.offblast/rommatches.bin
+rm ~/.offblast/ogdbrows.bin
+rm ~/.offblast/ogdbplatforms.bin
+rm ~/.offblast/launchshards.bin
+rm -r ~/.offblast/shards
+rm ~/.offblast/*.playranks